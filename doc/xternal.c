@@ -7328,6 +7328,17 @@
  * Please refer to the @ref reader_dec.h "DEC file reader" for further information about the required file format.
  * Upon reading a valid dec-file, a decomposition structure is created, where the corresponding variable labels are inferred from the constraint labels, giving precedence to block over linking constraints.
  *
+ * @section DECOMP_DETECT Automatic detection
+ *
+ * If no decomposition is given, SCIP can detect one by itself before the solving process starts, if the parameter
+ * decomposition/detect is set to TRUE.
+ * The detection, see SCIPdetectDecomp(), partitions the variables into blocks such that few constraints contain
+ * variables of different blocks, which then become linking constraints.
+ * For this purpose, the hypergraph whose vertices are the variables and whose edges are the constraints is partitioned
+ * by a multilevel scheme, see SCIPcomputeDecompPartition().
+ * Partitions into up to decomposition/detectmaxblocks blocks are computed and the one of highest modularity is added to
+ * the DecompStore.
+ *
  * @section DECOMP_BENDERS Use for Benders
  *
  * If the variables should be labeled for the application of @ref BENDDECF "Benders' decomposition", the decomposition must be explicitly flagged by setting the parameter decomposition/benderslabels to TRUE.
@@ -130,6 +130,8 @@
 #endif
 
 #define SOPLEX_VERBLEVEL                5    /**< verbosity level for LPINFO */
+#define SPARSEBINVFAC                   0.5  /**< maximal density of a row in B^-1 for which SCIPlpiGetBInvARow() loops
+                                              *   over the rows of A instead of the columns */
 
 #include "scip/pub_message.h"
 
@@ -3777,9 +3779,11 @@ SCIP_RETCODE SCIPlpiGetBInvARow(
 {
    SCIP_Real* buf;
    SCIP_Real* binv;
+   int nbinvnz;
    int nrows;
    int ncols;
    int c;
+   int i;
 
    SCIPdebugMessage("calling SCIPlpiGetBInvARow()\n");
 
@@ -3804,27 +3808,74 @@ SCIP_RETCODE SCIPlpiGetBInvARow(
 
    assert(binv != NULL);
 
+   /* count the nonzeros of the row in B^-1; if the sparsity pattern was computed above, we can use it directly */
+   if( binvrow == NULL && inds != NULL && ninds != NULL && *ninds >= 0 )
+      nbinvnz = *ninds;
+   else
+   {
+      nbinvnz = 0;
+      for( i = 0; i < nrows; ++i )
+      {
+         if( binv[i] != 0.0 )
+            ++nbinvnz;
+      }
+   }
+
    /* mark sparsity pattern as invalid */
    if( ninds != NULL )
       *ninds = -1;
 
-   // @todo exploit sparsity in binv by looping over nrows
-   /* calculate the scalar product of the row in B^-1 and A */
-   Vector binvvec(nrows, binv);
+   if( nbinvnz <= SPARSEBINVFAC * nrows )
+   {
+      /* the row in B^-1 is sparse: accumulate the rows of A with nonzero multiplier, which only touches the nonzeros
+       * of these rows instead of all columns of A
+       */
+#if SOPLEX_VERSION > 221 || (SOPLEX_VERSION == 221 && SOPLEX_SUBVERSION >= 4)
+      /* temporary unscaled row of A */
+      DSVector arow;
+#endif
+
+      BMSclearMemoryArray(coef, ncols);
+
+      for( i = 0; i < nrows; ++i )
+      {
+         SCIP_Real mult;
+         int j;
+
+         mult = binv[i];
+
+         if( mult == 0.0 )
+            continue;
 
 #if SOPLEX_VERSION > 221 || (SOPLEX_VERSION == 221 && SOPLEX_SUBVERSION >= 4)
-   /* temporary unscaled column of A */
-   DSVector acol;
+         lpi->spx->getRowVectorReal(i, arow);
+#else
+         const SVector& arow = lpi->spx->rowVectorReal(i);
 #endif
 
-   for( c = 0; c < ncols; ++c )
+         for( j = 0; j < arow.size(); ++j )
+            coef[arow.index(j)] += mult * arow.value(j);
+      }
+   }
+   else
    {
+      /* calculate the scalar product of the row in B^-1 and A */
+      Vector binvvec(nrows, binv);
+
+#if SOPLEX_VERSION > 221 || (SOPLEX_VERSION == 221 && SOPLEX_SUBVERSION >= 4)
+      /* temporary unscaled column of A */
+      DSVector acol;
+#endif
+
+      for( c = 0; c < ncols; ++c )
+      {
 #if SOPLEX_VERSION > 221 || (SOPLEX_VERSION == 221 && SOPLEX_SUBVERSION >= 4)
-      lpi->spx->getColVectorReal(c, acol);
-      coef[c] = binvvec * acol;  /* scalar product */ /*lint !e1702*/
+         lpi->spx->getColVectorReal(c, acol);
+         coef[c] = binvvec * acol;  /* scalar product */ /*lint !e1702*/
 #else
-      coef[c] = binvvec * lpi->spx->colVectorReal(c);  /* scalar product */ /*lint !e1702*/
+         coef[c] = binvvec * lpi->spx->colVectorReal(c);  /* scalar product */ /*lint !e1702*/
 #endif
+      }
    }
 
    /* free memory if it was temporarily allocated */
@@ -260,23 +260,17 @@ typedef struct
    WARMSTARTINFO*        upwarmstartinfo;    /**< the warm start info containing the lp data from a previous up branch */
 } CANDIDATE;
 
-/** Allocates the candidate on the buffer and initializes it with default values. */
+/** Initializes the candidate with default values. */
 static
-SCIP_RETCODE candidateCreate(
-   SCIP*                 scip,               /**< SCIP data structure */
-   CANDIDATE**           candidate           /**< the candidate to allocate and initialize */
+void candidateInit(
+   CANDIDATE*            candidate           /**< the candidate to initialize */
    )
 {
-   assert(scip != NULL);
    assert(candidate != NULL);
 
-   SCIP_CALL( SCIPallocBlockMemory(scip, candidate) );
-
-   (*candidate)->downwarmstartinfo = NULL;
-   (*candidate)->upwarmstartinfo = NULL;
-   (*candidate)->branchvar = NULL;
-
-   return SCIP_OKAY;
+   candidate->downwarmstartinfo = NULL;
+   candidate->upwarmstartinfo = NULL;
+   candidate->branchvar = NULL;
 }
 
 /** free the warm starting information for the given candidate */
@@ -306,27 +300,6 @@ SCIP_RETCODE candidateFreeWarmStartInfo(
 }
 
 
-/** Frees the allocated buffer memory of the candidate and clears the contained lpi memories. */
-static
-SCIP_RETCODE candidateFree(
-   SCIP*                 scip,               /**< SCIP data structure */
-   CANDIDATE**           candidate           /**< the candidate to free */
-   )
-{
-   assert(scip != NULL);
-   assert(candidate != NULL);
-
-   LABdebugMessage(scip, SCIP_VERBLEVEL_FULL, "freeing candidate <%s>(%u/%u)...\n",
-      (*candidate) != NULL ? SCIPvarGetName((*candidate)->branchvar) : "none",
-      (*candidate)->upwarmstartinfo != NULL, (*candidate)->downwarmstartinfo != NULL);
-
-   /* if a candidate is freed, we no longer need the content of the warm start info */
-   SCIP_CALL( candidateFreeWarmStartInfo(scip, *candidate) );
-
-   SCIPfreeBlockMemory(scip, candidate);
-   return SCIP_OKAY;
-}
-
 /** Store the current lp solution in the warm start info for further usage. */
 static
 SCIP_RETCODE candidateStoreWarmStartInfo(
@@ -1561,6 +1534,8 @@ void binConsDataFree(
 typedef struct
 {
    CANDIDATE**           candidates;         /**< the array of candidates */
+   CANDIDATE*            candidatestore;     /**< the candidates owned by the list, stored in one array, or NULL if the
+                                              *   list only references candidates of another list */
    int                   ncandidates;        /**< the number of actual entries in candidates (without trailing NULLs); this
                                               *   is NOT the length of the candidates array, but the number of candidates in
                                               *   it */
@@ -1587,12 +1562,16 @@ SCIP_RETCODE candidateListCreate(
    else
       (*candidatelist)->candidates = NULL;
 
+   (*candidatelist)->candidatestore = NULL;
    (*candidatelist)->ncandidates = ncandidates;
 
    return SCIP_OKAY;
 }
 
-/** allocates the given list and fills it with all fractional candidates of the current LP solution. */
+/** allocates the given list and fills it with all fractional candidates of the current LP solution; the candidates are
+ *  stored in a single array owned by the list, since in the deeper levels of the lookahead a list is created for every
+ *  evaluated child
+ */
 static
 SCIP_RETCODE candidateListGetAllFractionalCandidates(
    SCIP*                 scip,               /**< SCIP data structure */
@@ -1617,12 +1596,17 @@ SCIP_RETCODE candidateListGetAllFractionalCandidates(
 
    SCIP_CALL( candidateListCreate(scip, candidatelist, nlpcands) );
 
+   if( nlpcands > 0 )
+   {
+      SCIP_CALL( SCIPallocBufferArray(scip, &(*candidatelist)->candidatestore, nlpcands) );
+   }
+
    for( i = 0; i < nlpcands; i++ )
    {
       CANDIDATE* candidate;
 
-      SCIP_CALL( candidateCreate(scip, &candidate) );
-      assert(candidate != NULL);
+      candidate = &(*candidatelist)->candidatestore[i];
+      candidateInit(candidate);
 
       candidate->branchvar = lpcands[i];
       candidate->branchval = lpcandssol[i];
@@ -1637,7 +1621,7 @@ SCIP_RETCODE candidateListGetAllFractionalCandidates(
    return SCIP_OKAY;
 }
 
-/** frees the allocated buffer memory of the candidate list and frees the contained candidates. */
+/** frees the allocated buffer memory of the candidate list and frees the contained candidates, if the list owns them */
 static
 SCIP_RETCODE candidateListFree(
    SCIP*                 scip,               /**< SCIP data structure */
@@ -1657,10 +1641,14 @@ SCIP_RETCODE candidateListFree(
          CANDIDATE* cand = (*candidatelist)->candidates[i];
          if( cand != NULL )
          {
-            SCIP_CALL( candidateFree(scip, &cand) );
+            assert((*candidatelist)->candidatestore != NULL);
+
+            /* if a candidate is freed, we no longer need the content of the warm start info */
+            SCIP_CALL( candidateFreeWarmStartInfo(scip, cand) );
          }
       }
 
+      SCIPfreeBufferArrayNull(scip, &(*candidatelist)->candidatestore);
       SCIPfreeBufferArray(scip, &(*candidatelist)->candidates);
    }
    SCIPfreeBuffer(scip, candidatelist);
@@ -1689,7 +1677,9 @@ SCIP_RETCODE candidateListKeep(
       CANDIDATE* cand = candidatelist->candidates[i];
       if( cand != NULL )
       {
-         SCIP_CALL( candidateFree(scip, &cand) );
+         assert(candidatelist->candidatestore != NULL);
+
+         SCIP_CALL( candidateFreeWarmStartInfo(scip, cand) );
          candidatelist->candidates[i] = NULL;
       }
    }
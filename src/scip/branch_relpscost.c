@@ -1285,7 +1285,10 @@ SCIP_RETCODE execRelpscost(
          gmieffscore = SCIPgetVarAvgGMIScore(scip, branchcands[c]);
          lastgmieffscore = SCIPgetVarLastGMIScore(scip, branchcands[c]);
          nlscore = calcNlscore(scip, branchruledata->nlcount, branchruledata->nlcountmax, SCIPvarGetProbindex(branchcands[c]));
-         pscostscore = SCIPgetVarPseudocostScore(scip, branchcands[c], branchcandssol[c]);
+         /* the gains are the pseudo costs of rounding the LP solution value down and up, so the pseudo cost score
+          * follows from them without looking up the pseudo costs again
+          */
+         pscostscore = SCIPgetBranchScore(scip, branchcands[c], downgain, upgain);
          usesb = FALSE;
          if( useancpscost )
             pscostscore = SCIPgetVarDPseudocostScore(scip, branchcands[c], branchcandssol[c],branchruledata->discountfactor);
@@ -63,6 +63,10 @@
 #include "scip/scip_timing.h"
 #include "scip/scip_tree.h"
 #include "scip/scip_var.h"
+#include "scip/scip_concurrent.h"
+#include "scip/syncstore.h"
+#include "tpi/tpi.h"
+#include "tpi/def_openmp.h"
 #include <string.h>
 
 #define CONSHDLR_NAME          "components"
@@ -89,6 +93,7 @@
 #define DEFAULT_INTFACTOR           1.0      /**< the weight of an integer variable compared to binary variables */
 #define DEFAULT_CONTFACTOR          0.2      /**< the weight of a continuous variable compared to a binary variable */
 #define DEFAULT_FEASTOLFACTOR       1.0      /**< default value for parameter to increase the feasibility tolerance in all sub-SCIPs */
+#define DEFAULT_NTHREADS              1      /**< maximum number of threads to solve components in parallel during presolving (1: sequential) */
 
 /*
  * Data structures
@@ -123,6 +128,18 @@ typedef struct Component
    int                   number;             /**< component number */
 } COMPONENT;
 
+/** data related to one component that is solved in a parallel job during presolving */
+typedef struct PresolComponent
+{
+   SCIP*                 subscip;            /**< sub-SCIP representing the component */
+   SCIP_VAR**            vars;               /**< variables belonging to this component (in main SCIP) */
+   SCIP_VAR**            subvars;            /**< variables belonging to this component (in sub-SCIP) */
+   SCIP_CONS**           conss;              /**< constraints belonging to this component (in main SCIP) */
+   int                   nvars;              /**< number of variables belonging to this component */
+   int                   nconss;             /**< number of constraints belonging to this component */
+   SCIP_Bool             solve;              /**< are there resources left to solve the sub-SCIP? */
+} PRESOLCOMPONENT;
+
 /** data related to one problem
  *  (corresponding to one node in the branch-and-bound tree and consisting of multiple components)
  */
@@ -161,6 +178,8 @@ struct SCIP_ConshdlrData
                                               *   individually during branch-and-bound */
    int                   subscipdepth;       /**< depth offset of the current (sub-)problem compared to the original
                                               *   problem */
+   int                   nthreads;           /**< maximum number of threads to solve components in parallel during
+                                              *   presolving (1: sequential) */
 };
 
 
@@ -456,6 +475,7 @@ static
 SCIP_RETCODE createSubscip(
    SCIP*                 scip,               /**< main SCIP data structure */
    SCIP_CONSHDLRDATA*    conshdlrdata,       /**< constraint handler data */
+   SCIP_Bool             passmessagehdlr,    /**< should the message handler be passed to the sub-SCIP? */
    SCIP**                subscip             /**< pointer to store created sub-SCIP */
    )
 {
@@ -466,13 +486,17 @@ SCIP_RETCODE createSubscip(
    /* create a new SCIP instance */
    SCIP_CALL( SCIPcreate(subscip) );
 
+   /* a sub-SCIP that is solved on another thread keeps its own message handler */
+   if( !passmessagehdlr )
+      SCIPsetMessagehdlrQuiet(*subscip, SCIPmessagehdlrIsQuiet(SCIPgetMessagehdlr(scip)));
+
    /* copy plugins, we omit pricers (because we do not run if there are active pricers) and dialogs */
 #ifdef SCIP_MORE_DEBUG /* we print statistics later, so we need to copy statistics tables */
    SCIP_CALL( SCIPcopyPlugins(scip, *subscip, TRUE, FALSE, TRUE, TRUE, TRUE, TRUE, TRUE,
-         TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, FALSE, TRUE, TRUE, TRUE, TRUE, &success) );
+         TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, FALSE, TRUE, TRUE, TRUE, passmessagehdlr, &success) );
 #else
    SCIP_CALL( SCIPcopyPlugins(scip, *subscip, TRUE, FALSE, TRUE, TRUE, TRUE, TRUE, TRUE,
-         TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, FALSE, FALSE, TRUE, TRUE, TRUE, &success) );
+         TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, FALSE, FALSE, TRUE, TRUE, passmessagehdlr, &success) );
 #endif
 
    /* the plugins were successfully copied */
@@ -640,7 +664,7 @@ SCIP_RETCODE componentCreateSubscip(
 
    (*success) = TRUE;
 
-   SCIP_CALL( createSubscip(scip, conshdlrdata, &component->subscip) );
+   SCIP_CALL( createSubscip(scip, conshdlrdata, TRUE, &component->subscip) );
 
    if( component->subscip != NULL )
    {
@@ -667,13 +691,19 @@ SCIP_RETCODE componentCreateSubscip(
    return SCIP_OKAY;
 }
 
-/** solve a given sub-SCIP up to the given limits */
+/** set the limits of a given sub-SCIP from the remaining resources of the main SCIP
+ *
+ *  If several sub-SCIPs are solved at the same time, the remaining memory and the node limit are split evenly among
+ *  them, such that they do not use more resources together than a single sub-SCIP solved after the other.
+ */
 static
-SCIP_RETCODE solveSubscip(
+SCIP_RETCODE setupSubscipLimits(
    SCIP*                 scip,               /**< main SCIP */
    SCIP*                 subscip,            /**< sub-SCIP to solve */
    SCIP_Longint          nodelimit,          /**< node limit */
-   SCIP_Real             gaplimit            /**< gap limit */
+   SCIP_Real             gaplimit,           /**< gap limit */
+   int                   nconcurrent,        /**< number of sub-SCIPs solved concurrently (including this one) */
+   SCIP_Bool*            solve               /**< pointer to store whether enough resources are left to solve the sub-SCIP */
    )
 {
    SCIP_Real timelimit;
@@ -682,6 +712,10 @@ SCIP_RETCODE solveSubscip(
 
    assert(scip != NULL);
    assert(subscip != NULL);
+   assert(nconcurrent >= 1);
+   assert(solve != NULL);
+
+   *solve = FALSE;
 
    /* set time limit */
    SCIP_CALL( SCIPgetRealParam(scip, "limits/time", &timelimit) );
@@ -698,6 +732,7 @@ SCIP_RETCODE solveSubscip(
    {
       memorylimit -= SCIPgetMemUsed(scip)/1048576.0;
       memorylimit -= SCIPgetMemExternEstim(scip)/1048576.0;
+      memorylimit /= nconcurrent;
    }
 
    /* check if mem limit needs to be avoided */
@@ -723,6 +758,10 @@ SCIP_RETCODE solveSubscip(
 
    /* set time and memory limit for the subproblem */
    SCIP_CALL( SCIPsetRealParam(subscip, "limits/time", timelimit) );
+   if( nconcurrent > 1 && !SCIPisInfinity(scip, memorylimit) )
+   {
+      SCIP_CALL( SCIPsetRealParam(subscip, "limits/memory", MAX(memorylimit, 0.0)) );
+   }
 
    /* only set soft time limit if it exists */
    if( SCIPgetParam(scip, "limits/softtime") != NULL )
@@ -745,8 +784,31 @@ SCIP_RETCODE solveSubscip(
    SCIP_CALL( SCIPsetRealParam(subscip, "limits/gap", gaplimit) );
 
    /* set node limit */
+   if( nodelimit > 0 )
+      nodelimit = MAX(nodelimit / nconcurrent, 1);
    SCIP_CALL( SCIPsetLongintParam(subscip, "limits/nodes", nodelimit) );
 
+   *solve = TRUE;
+
+   return SCIP_OKAY;
+}
+
+/** solve a given sub-SCIP up to the given limits */
+static
+SCIP_RETCODE solveSubscip(
+   SCIP*                 scip,               /**< main SCIP */
+   SCIP*                 subscip,            /**< sub-SCIP to solve */
+   SCIP_Longint          nodelimit,          /**< node limit */
+   SCIP_Real             gaplimit            /**< gap limit */
+   )
+{
+   SCIP_Bool solve;
+
+   SCIP_CALL( setupSubscipLimits(scip, subscip, nodelimit, gaplimit, 1, &solve) );
+
+   if( !solve )
+      return SCIP_OKAY;
+
    /* solve the subproblem */
    SCIP_CALL( SCIPsolve(subscip) );
 
@@ -758,12 +820,11 @@ SCIP_RETCODE solveSubscip(
    return SCIP_OKAY;
 }
 
-/** solve a connected component during presolving and evaluate the result */
+/** evaluate the result of solving a connected component during presolving */
 static
-SCIP_RETCODE solveAndEvalSubscip(
+SCIP_RETCODE evalSubscip(
    SCIP*                 scip,               /**< SCIP main data structure */
-   SCIP_CONSHDLRDATA*    conshdlrdata,       /**< the components constraint handler data */
-   SCIP*                 subscip,            /**< sub-SCIP to be solved */
+   SCIP*                 subscip,            /**< sub-SCIP that was solved */
    SCIP_VAR**            vars,               /**< array of variables copied to this component */
    SCIP_VAR**            subvars,            /**< array of sub-SCIP variables corresponding to the vars array */
    SCIP_CONS**           conss,              /**< array of constraints copied to this component */
@@ -779,7 +840,6 @@ SCIP_RETCODE solveAndEvalSubscip(
    int i;
 
    assert(scip != NULL);
-   assert(conshdlrdata != NULL);
    assert(subscip != NULL);
    assert(vars != NULL);
    assert(conss != NULL);
@@ -790,8 +850,6 @@ SCIP_RETCODE solveAndEvalSubscip(
 
    *solved  = FALSE;
 
-   SCIP_CALL( solveSubscip(scip, subscip, conshdlrdata->nodelimit, 0.0) );
-
    if( SCIPgetStatus(subscip) == SCIP_STATUS_OPTIMAL )
    {
       SCIP_SOL* sol;
@@ -1015,6 +1073,316 @@ SCIP_RETCODE solveAndEvalSubscip(
    return SCIP_OKAY;
 }
 
+/** solve a connected component during presolving and evaluate the result */
+static
+SCIP_RETCODE solveAndEvalSubscip(
+   SCIP*                 scip,               /**< SCIP main data structure */
+   SCIP_CONSHDLRDATA*    conshdlrdata,       /**< the components constraint handler data */
+   SCIP*                 subscip,            /**< sub-SCIP to be solved */
+   SCIP_VAR**            vars,               /**< array of variables copied to this component */
+   SCIP_VAR**            subvars,            /**< array of sub-SCIP variables corresponding to the vars array */
+   SCIP_CONS**           conss,              /**< array of constraints copied to this component */
+   int                   nvars,              /**< number of variables copied to this component */
+   int                   nconss,             /**< number of constraints copied to this component */
+   int*                  ndeletedconss,      /**< pointer to store the number of deleted constraints */
+   int*                  nfixedvars,         /**< pointer to store the number of fixed variables */
+   int*                  ntightenedbounds,   /**< pointer to store the number of bound tightenings */
+   SCIP_RESULT*          result,             /**< pointer to store the result of the component solving */
+   SCIP_Bool*            solved              /**< pointer to store if the problem was solved to optimality */
+   )
+{
+   assert(conshdlrdata != NULL);
+
+   SCIP_CALL( solveSubscip(scip, subscip, conshdlrdata->nodelimit, 0.0) );
+
+   SCIP_CALL( evalSubscip(scip, subscip, vars, subvars, conss, nvars, nconss, ndeletedconss, nfixedvars,
+         ntightenedbounds, result, solved) );
+
+   return SCIP_OKAY;
+}
+
+/** job function solving the sub-SCIP of a component on a worker thread during presolving */
+static
+SCIP_RETCODE solvePresolComponentJob(
+   void*                 args                /**< the component of type PRESOLCOMPONENT */
+   )
+{
+   PRESOLCOMPONENT* presolcomp;
+
+   presolcomp = (PRESOLCOMPONENT*)args;
+   assert(presolcomp != NULL);
+   assert(presolcomp->subscip != NULL);
+
+   SCIP_CALL( SCIPsolve(presolcomp->subscip) );
+
+   return SCIP_OKAY;
+}
+
+/** frees the sub-SCIPs and sub-variable arrays of a batch of components solved in parallel */
+static
+SCIP_RETCODE freePresolComponents(
+   SCIP*                 scip,               /**< SCIP main data structure */
+   PRESOLCOMPONENT*      presolcomps,        /**< components of the batch */
+   int                   nbatch              /**< number of components in the batch */
+   )
+{
+   int b;
+
+   for( b = 0; b < nbatch; ++b )
+   {
+      if( presolcomps[b].subvars != NULL )
+      {
+         SCIPfreeBlockMemoryArray(scip, &presolcomps[b].subvars, presolcomps[b].nvars);
+      }
+      if( presolcomps[b].subscip != NULL )
+      {
+         SCIP_CALL( SCIPfree(&presolcomps[b].subscip) );
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
+/** solves the small components during presolving in parallel on the task processing interface
+ *
+ *  The components are processed in batches of at most nthreads components. The sub-SCIPs of a batch are created and
+ *  set up sequentially, since copying accesses the main SCIP, and are then solved concurrently with the remaining time
+ *  limit of the main SCIP and an even share of its remaining memory and of the node limit. Afterwards, the results are
+ *  transferred to the main SCIP in the order of the components, such that the reductions do not depend on the order
+ *  in which the jobs finish. As in the sequential loop, the last component is only solved if some other component was
+ *  not solved, so it is put into a batch of its own.
+ */
+static
+SCIP_RETCODE presolveComponentsParallel(
+   SCIP*                 scip,               /**< SCIP main data structure */
+   SCIP_CONSHDLRDATA*    conshdlrdata,       /**< the components constraint handler data */
+   SCIP_VAR**            sortedvars,         /**< array of variables sorted by components */
+   SCIP_CONS**           sortedconss,        /**< array of constraints sorted by components */
+   int*                  compstartsvars,     /**< start points of components in sortedvars array */
+   int*                  compstartsconss,    /**< start points of components in sortedconss array */
+   int                   nsortedconss,       /**< number of constraints in sortedconss array */
+   int                   ncomponents,        /**< number of components */
+   int                   ncompsmaxsize,      /**< number of components small enough to be solved */
+   int*                  ndeletedconss,      /**< pointer to store the number of deleted constraints */
+   int*                  nfixedvars,         /**< pointer to store the number of fixed variables */
+   int*                  ntightenedbounds,   /**< pointer to store the number of bound tightenings */
+   SCIP_RESULT*          result              /**< pointer to store the result of the component solving */
+   )
+{
+   PRESOLCOMPONENT* presolcomps;
+   SCIP_HASHMAP* consmap;
+   SCIP_RETCODE retcode;
+   SCIP_Bool stop;
+   int nthreads;
+   int nsolved;
+   int nbatch;
+   int comp;
+
+   assert(conshdlrdata != NULL);
+   assert(conshdlrdata->nthreads > 1);
+
+   nthreads = conshdlrdata->nthreads;
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &presolcomps, nthreads) );
+
+   /* hashmap mapping from original constraints to constraints in the sub-SCIPs (for performance reasons) */
+   SCIP_CALL( SCIPhashmapCreate(&consmap, SCIPblkmem(scip), nsortedconss) );
+
+   SCIP_CALL( SCIPtpiInit(nthreads, INT_MAX, FALSE) );
+
+   retcode = SCIP_OKAY;
+   stop = FALSE;
+   nsolved = 0;
+   nbatch = 0;
+   comp = 0;
+
+   /* if there is only one component left, it is solved in the main SCIP */
+   while( comp < ncompsmaxsize && !stop && nsolved < ncomponents - 1 && !SCIPisStopped(scip) )
+   {
+      int jobid;
+      int b;
+
+      nbatch = 0;
+
+      /* create the sub-SCIPs of the next batch of components */
+      for( ; comp < ncompsmaxsize && nbatch < nthreads; ++comp )
+      {
+         char name[SCIP_MAXSTRLEN];
+         PRESOLCOMPONENT* presolcomp;
+         SCIP_HASHMAP* varmap;
+         SCIP_Bool success;
+
+         /* the last component is only solved if not all other components are solved */
+         if( comp == ncomponents - 1 && nbatch > 0 )
+            break;
+
+         presolcomp = &presolcomps[nbatch];
+         presolcomp->vars = &(sortedvars[compstartsvars[comp]]);
+         presolcomp->nvars = compstartsvars[comp + 1] - compstartsvars[comp];
+         presolcomp->conss = &(sortedconss[compstartsconss[comp]]);
+         presolcomp->nconss = compstartsconss[comp + 1] - compstartsconss[comp];
+         presolcomp->subscip = NULL;
+         presolcomp->subvars = NULL;
+         presolcomp->solve = FALSE;
+
+         /* if we have an unlocked variable, let duality fixing do the job! */
+         if( presolcomp->nconss == 0 )
+         {
+            assert(presolcomp->nvars == 1);
+            continue;
+         }
+
+         /* from now on, the component belongs to the batch, such that it is freed on errors */
+         ++nbatch;
+
+         SCIP_CALL_TERMINATE( retcode, createSubscip(scip, conshdlrdata, FALSE, &presolcomp->subscip), TERMINATE );
+
+         if( presolcomp->subscip == NULL )
+         {
+            --nbatch;
+            stop = TRUE;
+            break;
+         }
+
+         SCIP_CALL_TERMINATE( retcode, SCIPsetBoolParam(presolcomp->subscip, "misc/usesmalltables", TRUE), TERMINATE );
+         SCIP_CALL_TERMINATE( retcode, SCIPsetIntParam(presolcomp->subscip, "constraints/" CONSHDLR_NAME "/propfreq", -1), TERMINATE );
+
+         /* the CPU time of the process advances with all threads, so the time limits refer to the wall clock time;
+          * interrupts are caught by the main SCIP only
+          */
+         SCIP_CALL_TERMINATE( retcode, SCIPsetIntParam(presolcomp->subscip, "timing/clocktype", (int)SCIP_CLOCKTYPE_WALL), TERMINATE );
+         SCIP_CALL_TERMINATE( retcode, SCIPsetBoolParam(presolcomp->subscip, "misc/catchctrlc", FALSE), TERMINATE );
+
+         SCIP_ALLOC_TERMINATE( retcode, BMSallocBlockMemoryArray(SCIPblkmem(scip), &presolcomp->subvars, presolcomp->nvars), TERMINATE );
+         SCIP_CALL_TERMINATE( retcode, SCIPhashmapCreate(&varmap, SCIPblkmem(scip), presolcomp->nvars), TERMINATE );
+
+         /* get name of the original problem and add "comp_nr" */
+         (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "%s_comp_%d", SCIPgetProbName(scip), comp);
+
+         retcode = copyToSubscip(scip, presolcomp->subscip, name, presolcomp->vars, presolcomp->subvars,
+            presolcomp->conss, varmap, consmap, presolcomp->nvars, presolcomp->nconss, &success);
+
+         SCIPhashmapFree(&varmap);
+
+         if( retcode != SCIP_OKAY )
+         {
+            SCIPerrorMessage("Error <%d> in function call\n", retcode);
+            goto TERMINATE;
+         }
+
+         if( !success )
+         {
+            --nbatch;
+            SCIP_CALL_TERMINATE( retcode, freePresolComponents(scip, presolcomp, 1), TERMINATE );
+            continue;
+         }
+
+         /* set up debug solution */
+#ifdef WITH_DEBUG_SOLUTION
+         if( SCIPdebugSolIsEnabled(scip) )
+         {
+            SCIP_SOL* debugsol;
+            SCIP_Real val;
+            int i;
+
+            SCIP_CALL_TERMINATE( retcode, SCIPdebugGetSol(scip, &debugsol), TERMINATE );
+
+            /* set solution values in the debug solution if it is available */
+            if( debugsol != NULL )
+            {
+               SCIPdebugSolEnable(presolcomp->subscip);
+
+               for( i = 0; i < presolcomp->nvars; ++i )
+               {
+                  if( presolcomp->subvars[i] != NULL )
+                  {
+                     SCIP_CALL_TERMINATE( retcode, SCIPdebugGetSolVal(scip, presolcomp->vars[i], &val), TERMINATE );
+                     SCIP_CALL_TERMINATE( retcode, SCIPdebugAddSolVal(presolcomp->subscip, presolcomp->subvars[i], val), TERMINATE );
+                  }
+               }
+            }
+         }
+#endif
+      }
+
+      /* the limits depend on the number of sub-SCIPs that are solved concurrently */
+      for( b = 0; b < nbatch; ++b )
+      {
+         SCIP_CALL_TERMINATE( retcode, setupSubscipLimits(scip, presolcomps[b].subscip, conshdlrdata->nodelimit, 0.0,
+               nbatch, &presolcomps[b].solve), TERMINATE );
+      }
+
+      SCIPdebugMsg(scip, "solving batch of %d components in parallel\n", nbatch);
+
+      /* solve the sub-SCIPs of the batch concurrently */
+      jobid = SCIPtpiGetNewJobID();
+
+      TPI_PARA
+      {
+         TPI_SINGLE
+         {
+            for( b = 0; b < nbatch; ++b )
+            {
+               /* cppcheck-suppress unassignedVariable */
+               SCIP_JOB* job;
+               SCIP_SUBMITSTATUS status;
+
+               if( !presolcomps[b].solve )
+                  continue;
+
+               SCIP_CALL_ABORT( SCIPtpiCreateJob(&job, jobid, solvePresolComponentJob, &presolcomps[b]) );
+               SCIP_CALL_ABORT( SCIPtpiSubmitJob(job, &status) );
+
+               assert(status == SCIP_SUBMIT_SUCCESS);
+            }
+         }
+      }
+
+      SCIP_CALL_TERMINATE( retcode, SCIPtpiCollectJobs(jobid), TERMINATE );
+
+      /* transfer the results in the order of the components */
+      for( b = 0; b < nbatch && !stop; ++b )
+      {
+         SCIP_Bool solved;
+
+         SCIP_CALL_TERMINATE( retcode, evalSubscip(scip, presolcomps[b].subscip, presolcomps[b].vars,
+               presolcomps[b].subvars, presolcomps[b].conss, presolcomps[b].nvars, presolcomps[b].nconss,
+               ndeletedconss, nfixedvars, ntightenedbounds, result, &solved), TERMINATE );
+
+         if( solved )
+            ++nsolved;
+
+         /* if the component is unbounded or infeasible, this holds for the complete problem as well */
+         if( *result == SCIP_UNBOUNDED || *result == SCIP_CUTOFF )
+            stop = TRUE;
+      }
+
+      SCIP_CALL_TERMINATE( retcode, freePresolComponents(scip, presolcomps, nbatch), TERMINATE );
+      nbatch = 0;
+   }
+
+TERMINATE:
+   /* free the sub-SCIPs of an interrupted batch; the thread pool has to be released in any case */
+   if( nbatch > 0 )
+   {
+      (void) freePresolComponents(scip, presolcomps, nbatch);
+   }
+
+   if( retcode == SCIP_OKAY )
+   {
+      retcode = SCIPtpiExit();
+   }
+   else
+   {
+      (void) SCIPtpiExit();
+   }
+
+   SCIPhashmapFree(&consmap);
+   SCIPfreeBufferArray(scip, &presolcomps);
+
+   return retcode;
+}
+
 /** (continues) solving a connected component */
 static
 SCIP_RETCODE solveComponent(
@@ -2355,7 +2723,19 @@ SCIP_DECL_CONSPRESOL(consPresolComponents)
    SCIP_CALL( findComponents(scip, conshdlrdata, NULL, sortedvars, sortedconss, compstartsvars,
          compstartsconss, &nsortedvars, &nsortedconss, &ncomponents, &ncompsminsize, &ncompsmaxsize) );
 
-   if( ncompsmaxsize > 0 )
+   /* solve the components in parallel if requested, if this is not a sub-SCIP (whose caller may already run on a
+    * worker thread) and if the task processing interface is not in use
+    */
+   if( ncompsmaxsize > 1 && conshdlrdata->nthreads > 1 && SCIPgetSubscipDepth(scip) == 0 && SCIPtpiIsAvailable()
+      && !SCIPsyncstoreIsInitialized(SCIPgetSyncstore(scip)) )
+   {
+      SCIPdebugMsg(scip, "found %d components (%d with small size) during presolving, solve them with %d threads\n",
+         ncomponents, ncompsmaxsize, conshdlrdata->nthreads);
+
+      SCIP_CALL( presolveComponentsParallel(scip, conshdlrdata, sortedvars, sortedconss, compstartsvars,
+            compstartsconss, nsortedconss, ncomponents, ncompsmaxsize, ndelconss, nfixedvars, nchgbds, result) );
+   }
+   else if( ncompsmaxsize > 0 )
    {
       char name[SCIP_MAXSTRLEN];
       SCIP* subscip;
@@ -2375,7 +2755,7 @@ SCIP_DECL_CONSPRESOL(consPresolComponents)
          ncomponents, ncompsmaxsize, SCIPgetNVars(scip), SCIPgetNBinVars(scip), SCIPgetNIntVars(scip), SCIPgetNContVars(scip) + SCIPgetNImplVars(scip), SCIPgetNConss(scip));
 
       /* build subscip */
-      SCIP_CALL( createSubscip(scip, conshdlrdata, &subscip) );
+      SCIP_CALL( createSubscip(scip, conshdlrdata, TRUE, &subscip) );
 
       if( subscip == NULL )
          goto TERMINATE;
@@ -2395,7 +2775,7 @@ SCIP_DECL_CONSPRESOL(consPresolComponents)
          if( SCIPgetStage(subscip) > SCIP_STAGE_INIT )
          {
             SCIP_CALL( SCIPfree(&subscip) );
-            SCIP_CALL( createSubscip(scip, conshdlrdata, &subscip) );
+            SCIP_CALL( createSubscip(scip, conshdlrdata, TRUE, &subscip) );
          }
 #endif
          /* get component variables */
@@ -2630,6 +3010,10 @@ SCIP_RETCODE SCIPincludeConshdlrComponents(
          "constraints/" CONSHDLR_NAME "/feastolfactor",
          "factor to increase the feasibility tolerance of the main SCIP in all sub-SCIPs, default value 1.0",
          &conshdlrdata->feastolfactor, TRUE, DEFAULT_FEASTOLFACTOR, 0.0, 1000000.0, NULL, NULL) );
+   SCIP_CALL( SCIPaddIntParam(scip,
+         "constraints/" CONSHDLR_NAME "/nthreads",
+         "maximum number of threads to solve components in parallel during presolving (1: sequential)",
+         &conshdlrdata->nthreads, TRUE, DEFAULT_NTHREADS, 1, 64, NULL, NULL) );
 
    return SCIP_OKAY;
 }
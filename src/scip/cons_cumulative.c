@@ -4597,6 +4597,8 @@ SCIP_RETCODE propagateUbTTEF(
    int*                  ubinferinfos,       /**< array to store the inference information for the upper bound changes */
    int*                  lsts,               /**< array of latest start time of the flexible part in the same order as the variables */
    int*                  flexenergies,       /**< array of flexible energies in the same order as the variables */
+   int*                  varests,            /**< array of earliest start times in the same order as the variables */
+   int*                  varlcts,            /**< array of latest completion times in the same order as the variables */
    int*                  perm,               /**< permutation of the variables w.r.t. the non-decreasing order of the earliest start times */
    int*                  ests,               /**< array with earliest strart times sorted in non-decreasing order */
    int*                  lcts,               /**< array with latest completion times sorted in non-decreasing order */
@@ -4624,8 +4626,8 @@ SCIP_RETCODE propagateUbTTEF(
    /* compute earliest start and latest completion time of all jobs */
    for( v = 0; v < nvars; ++v )
    {
-      start = SCIPconvertRealToInt(scip, SCIPvarGetLbLocal(vars[v]));
-      end = SCIPconvertRealToInt(scip, SCIPvarGetUbLocal(vars[v])) + durations[v];
+      start = varests[v];
+      end = varlcts[v];
 
       est = MIN(est, start);
       lct = MAX(lct, end);
@@ -4760,7 +4762,8 @@ SCIP_RETCODE propagateUbTTEF(
          demand = demands[idx];
          assert(demand > 0);
 
-         lct = SCIPconvertRealToInt(scip, SCIPvarGetUbLocal(var)) + duration;
+         lct = varlcts[idx];
+         assert(SCIPconvertRealToInt(scip, SCIPvarGetUbLocal(var)) + duration == lct);
 
          /* the latest start time of the free part of the job */
          lst = lsts[idx];
@@ -4871,8 +4874,8 @@ SCIP_RETCODE propagateUbTTEF(
             int newlb;
             int ect;
 
-            ect = SCIPconvertRealToInt(scip, SCIPvarGetLbLocal(vars[lbcand])) + durations[lbcand];
-            lst = SCIPconvertRealToInt(scip, SCIPvarGetUbLocal(vars[lbcand]));
+            ect = varests[lbcand] + durations[lbcand];
+            lst = varlcts[lbcand] - durations[lbcand];
 
             /* remove the energy of our job from the ... */
             energy = freeenergy + (computeCoreWithInterval(begin, end, ect, lst) + MAX(0, (SCIP_Longint) end - lsts[lbcand])) * demands[lbcand];
@@ -4948,6 +4951,8 @@ SCIP_RETCODE propagateLbTTEF(
    int*                  ubinferinfos,       /**< array to store the inference information for the upper bound changes */
    int*                  ects,               /**< array of earliest completion time of the flexible part in the same order as the variables */
    int*                  flexenergies,       /**< array of flexible energies in the same order as the variables */
+   int*                  varests,            /**< array of earliest start times in the same order as the variables */
+   int*                  varlcts,            /**< array of latest completion times in the same order as the variables */
    int*                  perm,               /**< permutation of the variables w.r.t. the non-decreasing order of the latest completion times */
    int*                  ests,               /**< array with earliest strart times sorted in non-decreasing order */
    int*                  lcts,               /**< array with latest completion times sorted in non-decreasing order */
@@ -4981,8 +4986,8 @@ SCIP_RETCODE propagateLbTTEF(
    /* compute earliest start and latest completion time of all jobs */
    for( v = 0; v < nvars; ++v )
    {
-      start = SCIPconvertRealToInt(scip, SCIPvarGetLbLocal(vars[v]));
-      end = SCIPconvertRealToInt(scip, SCIPvarGetUbLocal(vars[v])) + durations[v];
+      start = varests[v];
+      end = varlcts[v];
 
       minest = MIN(minest, start);
       maxlct = MAX(maxlct, end);
@@ -5089,7 +5094,8 @@ SCIP_RETCODE propagateLbTTEF(
          demand = demands[idx];
          assert(demand > 0);
 
-         est = SCIPconvertRealToInt(scip, SCIPvarGetLbLocal(var));
+         est = varests[idx];
+         assert(SCIPconvertRealToInt(scip, SCIPvarGetLbLocal(var)) == est);
 
          /* the earliest completion time of the flexible part of the job */
          ect = ects[idx];
@@ -5203,8 +5209,8 @@ SCIP_RETCODE propagateLbTTEF(
             duration = durations[ubcand];
             assert(duration > 0);
 
-            ect = SCIPconvertRealToInt(scip, SCIPvarGetLbLocal(vars[ubcand])) + duration;
-            lst = SCIPconvertRealToInt(scip, SCIPvarGetUbLocal(vars[ubcand]));
+            ect = varests[ubcand] + duration;
+            lst = varlcts[ubcand] - durations[ubcand];
 
             /* remove the energy of our job from the ... */
             energy = freeenergy + (computeCoreWithInterval(begin, end, ect, lst) + MAX(0, (SCIP_Longint) ects[ubcand] - begin)) * demands[ubcand];
@@ -5299,6 +5305,8 @@ SCIP_RETCODE propagateTTEF(
    int* ests;
    int* ects;
    int* lsts;
+   int* varests;
+   int* varlcts;
 
    int* newlbs;
    int* newubs;
@@ -5326,17 +5334,25 @@ SCIP_RETCODE propagateTTEF(
    SCIP_CALL( SCIPallocBufferArray(scip, &ests, nvars) );
    SCIP_CALL( SCIPallocBufferArray(scip, &ects, nvars) );
    SCIP_CALL( SCIPallocBufferArray(scip, &lsts, nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &varests, nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &varlcts, nvars) );
 
    SCIP_CALL( SCIPallocBufferArray(scip, &newlbs, nvars) );
    SCIP_CALL( SCIPallocBufferArray(scip, &newubs, nvars) );
    SCIP_CALL( SCIPallocBufferArray(scip, &lbinferinfos, nvars) );
    SCIP_CALL( SCIPallocBufferArray(scip, &ubinferinfos, nvars) );
 
-   /* we need to buffer the bound changes since the propagation algorithm cannot handle new bound dynamically */
+   /* we need to buffer the bound changes since the propagation algorithm cannot handle new bound dynamically; since the
+    * local bounds do not change until the buffered changes are applied, we also store the earliest start and latest
+    * completion times in the order of the variables once such that the quadratic loops below do not need to access the
+    * variables
+    */
    for( v = 0; v < nvars; ++v )
    {
       newlbs[v] = SCIPconvertRealToInt(scip, SCIPvarGetLbLocal(vars[v]));
       newubs[v] = SCIPconvertRealToInt(scip, SCIPvarGetUbLocal(vars[v]));
+      varests[v] = newlbs[v];
+      varlcts[v] = newubs[v] + durations[v];
       lbinferinfos[v] = 0;
       ubinferinfos[v] = 0;
    }
@@ -5355,12 +5371,12 @@ SCIP_RETCODE propagateTTEF(
 
    /* propagate the upper bounds and "opportunistically" the lower bounds */
    SCIP_CALL( propagateUbTTEF(scip, conshdlrdata, nvars, vars, durations, demands, capacity, hmin, hmax,
-         newlbs, newubs, lbinferinfos, ubinferinfos, lsts, flexenergies,
+         newlbs, newubs, lbinferinfos, ubinferinfos, lsts, flexenergies, varests, varlcts,
          permests, ests, lcts, coreEnergyAfterEst, coreEnergyAfterLct, initialized, explanation, cutoff) );
 
    /* propagate the lower bounds and "opportunistically" the upper bounds */
    SCIP_CALL( propagateLbTTEF(scip, conshdlrdata, nvars, vars, durations, demands, capacity, hmin, hmax,
-         newlbs, newubs, lbinferinfos, ubinferinfos, ects, flexenergies,
+         newlbs, newubs, lbinferinfos, ubinferinfos, ects, flexenergies, varests, varlcts,
          permlcts, ests, lcts, coreEnergyAfterEst, coreEnergyAfterLct, initialized, explanation, cutoff) );
 
    /* apply the buffer bound changes */
@@ -5463,6 +5479,8 @@ SCIP_RETCODE propagateTTEF(
    SCIPfreeBufferArray(scip, &newlbs);
 
    /* free buffer arrays */
+   SCIPfreeBufferArray(scip, &varlcts);
+   SCIPfreeBufferArray(scip, &varests);
    SCIPfreeBufferArray(scip, &lsts);
    SCIPfreeBufferArray(scip, &ects);
    SCIPfreeBufferArray(scip, &ests);
@@ -1061,8 +1061,8 @@ SCIP_RETCODE checkCons(
    return SCIP_OKAY;
 }
 
-/* IDX computes the integer index for the optimal solution array */
-#define IDX(j,d) ((j)*(intcap)+(d))
+/* NBITSPERWORD is the number of table entries stored in one word of the bit table of selected items */
+#define NBITSPERWORD ((int)(8*sizeof(unsigned int)))
 
 /** solves knapsack problem in maximization form exactly using dynamic programming;
  *  if needed, one can provide arrays to store all selected items and all not selected items
@@ -1071,11 +1071,11 @@ SCIP_RETCODE checkCons(
  *
  * @note the algorithm will first compute a greedy solution and terminate
  *       if the greedy solution is proven to be optimal.
- *       The dynamic programming algorithm runs with a time and space complexity
- *       of O(nitems * capacity).
+ *       The dynamic programming algorithm runs with a time complexity of O(nitems * capacity). It only stores a
+ *       single slice of optimal values with O(capacity) space; if the solution items are requested, one bit per item
+ *       and capacity is stored in addition to reconstruct the solution.
  *
- * @todo If only the objective is relevant, it is easy to change the code to use only one slice with O(capacity) space.
- *       There are recursive methods (see the book by Kellerer et al.) that require O(capacity) space, but it remains
+ * @todo There are recursive methods (see the book by Kellerer et al.) that require O(capacity) space, but it remains
  *       to be checked whether they are faster and whether they can reconstruct the solution.
  *       Dembo and Hammer (see Kellerer et al. Section 5.1.3, page 126) found a method that relies on a fast probing method.
  *       This fixes additional elements to 0 or 1 similar to a reduced cost fixing.
@@ -1102,7 +1102,9 @@ SCIP_RETCODE SCIPsolveKnapsackExactly(
    SCIP_RETCODE retcode;
    SCIP_Real* tempsort;
    SCIP_Real* optvalues;
+   unsigned int* takeitem;
    int intcap;
+   int tablewidth;
    int d;
    int j;
    int greedymedianpos;
@@ -1110,13 +1112,11 @@ SCIP_RETCODE SCIPsolveKnapsackExactly(
    int* myitems;
    SCIP_Longint* myweights;
    SCIP_Real* realweights;
-   int* allcurrminweight;
    SCIP_Real* myprofits;
    int nmyitems;
    SCIP_Longint gcd;
    SCIP_Longint minweight;
    SCIP_Longint maxweight;
-   int currminweight;
    SCIP_Longint greedysolweight;
    SCIP_Real greedysolvalue;
    SCIP_Real greedyupperbound;
@@ -1436,19 +1436,28 @@ SCIP_RETCODE SCIPsolveKnapsackExactly(
    assert(nmyitems > 0);
    assert(sizeof(size_t) >= sizeof(int)); /*lint !e506*/ /* no following conversion should be messed up */
 
-   /* this condition checks whether we will try to allocate a correct number of bytes and do not have an overflow, while
-    * computing the size for the allocation
+   /* the table of optimal values is stored as a single slice that is updated in place; if the solution items are
+    * requested, we additionally store for each item and each capacity whether the item is taken, which needs one bit
+    * per table entry
     */
-   if( intcap < 0 || (intcap > 0 && (((size_t)nmyitems) > (SIZE_MAX / (size_t)intcap / sizeof(*optvalues)) || ((size_t)nmyitems) * ((size_t)intcap) * sizeof(*optvalues) > ((size_t)INT_MAX) )) ) /*lint !e571*/
+   tablewidth = (intcap + NBITSPERWORD - 1) / NBITSPERWORD;
+
+   /* the work of the dynamic program is proportional to the number of table entries nmyitems * intcap, which we bound
+    * by the limit on the size of a full table of optimal values, regardless of whether the solution items are requested;
+    * this also bounds the size of the table of taken items and checks that its size computation does not overflow
+    */
+   if( intcap > 0 && (((size_t)nmyitems) > (SIZE_MAX / (size_t)intcap / sizeof(*optvalues))
+         || ((size_t)nmyitems) * ((size_t)intcap) * sizeof(*optvalues) > ((size_t)INT_MAX)) ) /*lint !e571*/
    {
-      SCIPdebugMsg(scip, "Too much memory (%lu) would be consumed.\n", (unsigned long) (((size_t)nmyitems) * ((size_t)intcap) * sizeof(*optvalues))); /*lint !e571*/
+      SCIPdebugMsg(scip, "Too much work (%lu table entries) would be needed.\n", (unsigned long) (((size_t)nmyitems) * ((size_t)intcap))); /*lint !e571*/
 
       *success = FALSE;
       goto TERMINATE;
    }
+   assert(((size_t)nmyitems) * ((size_t)tablewidth) * sizeof(*takeitem) <= ((size_t)INT_MAX)); /*lint !e571*/
 
    /* allocate temporary memory and check for memory exceedance */
-   retcode = SCIPallocBufferArray(scip, &optvalues, nmyitems * intcap);
+   retcode = SCIPallocBufferArray(scip, &optvalues, intcap);
    if( retcode == SCIP_NOMEMORY )
    {
       SCIPdebugMsg(scip, "Did not get enough memory.\n");
@@ -1461,116 +1470,107 @@ SCIP_RETCODE SCIPsolveKnapsackExactly(
       SCIP_CALL( retcode );
    }
 
+   takeitem = NULL;
+   if( solitems != NULL )
+   {
+      retcode = SCIPallocClearBufferArray(scip, &takeitem, nmyitems * tablewidth);
+      if( retcode == SCIP_NOMEMORY )
+      {
+         SCIPdebugMsg(scip, "Did not get enough memory.\n");
+
+         SCIPfreeBufferArray(scip, &optvalues);
+         *success = FALSE;
+         goto TERMINATE;
+      }
+      else
+      {
+         SCIP_CALL( retcode );
+      }
+   }
+
    SCIPdebugMsg(scip, "Start real exact algorithm.\n");
 
-   /* we memorize at each step the current minimal weight to later on know which value in our optvalues matrix is valid;
-    * each value entries of the j-th row of optvalues is valid if the index is >= allcurrminweight[j], otherwise it is
-    * invalid; a second possibility would be to clear the whole optvalues, which should be more expensive than storing
-    * 'nmyitem' values
+   /* the entry d of optvalues is the optimal value for capacity d + minweight using the items processed so far;
+    * for capacities below minweight, no item fits
     */
-   SCIP_CALL( SCIPallocBufferArray(scip, &allcurrminweight, nmyitems) );
-   assert(myweights[0] - minweight < INT_MAX);
-   currminweight = (int) (myweights[0] - minweight);
-   allcurrminweight[0] = currminweight;
+   BMSclearMemoryArray(optvalues, intcap);
 
-   /* fills first row of dynamic programming table with optimal values */
-   for( d = currminweight; d < intcap; ++d )
-      optvalues[d] = myprofits[0];
-
-   /* fills dynamic programming table with optimal values */
-   for( j = 1; j < nmyitems; ++j )
+   /* fills dynamic programming table with optimal values; the capacities are traversed in decreasing order, such that
+    * the entries for smaller capacities still refer to the previous items
+    */
+   for( j = 0; j < nmyitems; ++j )
    {
+      unsigned int* takerow;
+      SCIP_Real profit;
       int intweight;
 
       /* compute important part of weight, which will be represented in the table */
       intweight = (int)(myweights[j] - minweight);
       assert(0 <= intweight && intweight < intcap);
 
-      /* copy all nonzeros from row above */
-      for( d = currminweight; d < intweight && d < intcap; ++d )
-         optvalues[IDX(j,d)] = optvalues[IDX(j-1,d)];
+      profit = myprofits[j];
+      takerow = (takeitem != NULL ? &takeitem[(size_t)j * (size_t)tablewidth] : NULL);
 
-      /* update corresponding row */
-      for( d = intweight; d < intcap; ++d )
+      /* capacities for which the remaining capacity after taking the item is still at least minweight */
+      for( d = intcap - 1; d >= intweight + minweight; --d )
       {
-         /* if index d < current minweight then optvalues[IDX(j-1,d)] is not initialized, i.e. should be 0 */
-         if( d < currminweight )
-            optvalues[IDX(j,d)] = myprofits[j];
-         else
-         {
-            SCIP_Real sumprofit;
+         SCIP_Real sumprofit;
 
-            if( d - myweights[j] < currminweight )
-               sumprofit = myprofits[j];
-            else
-               sumprofit = optvalues[IDX(j-1,(int)(d-myweights[j]))] + myprofits[j];
-
-            optvalues[IDX(j,d)] = MAX(sumprofit, optvalues[IDX(j-1,d)]);
+         sumprofit = optvalues[d - (int)myweights[j]] + profit;
+         if( sumprofit > optvalues[d] )
+         {
+            optvalues[d] = sumprofit;
+            if( takerow != NULL )
+               takerow[d / NBITSPERWORD] |= 1U << (d % NBITSPERWORD); /*lint !e701*/
          }
       }
 
-      /* update currminweight */
-      if( intweight < currminweight )
-         currminweight = intweight;
-
-      allcurrminweight[j] = currminweight;
+      /* capacities for which only the item itself fits */
+      for( ; d >= intweight; --d )
+      {
+         if( profit > optvalues[d] )
+         {
+            optvalues[d] = profit;
+            if( takerow != NULL )
+               takerow[d / NBITSPERWORD] |= 1U << (d % NBITSPERWORD); /*lint !e701*/
+         }
+      }
    }
 
    /* update optimal solution by following the table */
    if( solitems != NULL )
    {
+      SCIP_Longint remaining;
+
       assert(nsolitems != NULL && nonsolitems != NULL && nnonsolitems != NULL);
-      d = intcap - 1;
+      assert(takeitem != NULL);
 
       SCIPdebugMsg(scip, "Fill the solution vector after solving exactly.\n");
 
-      /* insert all items in (non-) solution vector */
-      for( j = nmyitems - 1; j > 0; --j )
+      /* insert all items in (non-) solution vector; remaining is the index of the remaining capacity in the table,
+       * it becomes negative if the remaining capacity is below minweight
+       */
+      remaining = intcap - 1;
+      for( j = nmyitems - 1; j >= 0; --j )
       {
-         /* if the following condition holds this means all remaining items does not fit anymore */
-         if( d < allcurrminweight[j] )
-         {
-            /* we cannot have exceeded our capacity */
-            assert((SCIP_Longint) d >= -minweight);
-            break;
-         }
-
-         /* collect solution items; the first condition means that no further item can fit anymore, but this does */
-         if( d < allcurrminweight[j-1] || optvalues[IDX(j,d)] > optvalues[IDX(j-1,d)] )
+         if( remaining >= 0 && (takeitem[(size_t)j * (size_t)tablewidth + (size_t)(remaining / NBITSPERWORD)]
+               & (1U << (remaining % NBITSPERWORD))) != 0 ) /*lint !e701*/
          {
             solitems[(*nsolitems)++] = myitems[j];
-
-            /* check that we do not have an underflow */
-            assert(myweights[j] <= (INT_MAX + (SCIP_Longint) d));
-            d = (int)(d - myweights[j]);
+            remaining -= myweights[j];
          }
-         /* collect non-solution items */
          else
             nonsolitems[(*nnonsolitems)++] = myitems[j];
       }
 
-      /* insert remaining items */
-      if( d >= allcurrminweight[j] )
-      {
-         assert(j == 0);
-         solitems[(*nsolitems)++] = myitems[j];
-      }
-      else
-      {
-         assert(j >= 0);
-         assert(d < allcurrminweight[j]);
-
-         for( ; j >= 0; --j )
-            nonsolitems[(*nnonsolitems)++] = myitems[j];
-      }
-
       assert(*nsolitems + *nnonsolitems == nitems);
+
+      SCIPfreeBufferArray(scip, &takeitem);
    }
 
    /* update solution value */
    if( solval != NULL )
-      *solval += optvalues[IDX(nmyitems-1,intcap-1)];
-   SCIPfreeBufferArray(scip, &allcurrminweight);
+      *solval += optvalues[intcap-1];
 
    /* free all temporary memory */
    SCIPfreeBufferArray(scip, &optvalues);
@@ -327,6 +327,7 @@ static
 void selectBestCut(
    SCIP_ROW**            cuts,               /**< array with cuts to perform selection algorithm */
    SCIP_Real*            scores,             /**< array with scores of cuts to perform selection algorithm */
+   int*                  slots,              /**< array with positions of the parallelism signatures of cuts */
    int                   ncuts               /**< number of cuts in given array */
    )
 {
@@ -351,15 +352,25 @@ void selectBestCut(
 
    SCIPswapPointers((void**) &cuts[bestpos], (void**) &cuts[0]);
    SCIPswapReals(&scores[bestpos], &scores[0]);
+   SCIPswapInts(&slots[bestpos], &slots[0]);
 }
 
 /** filters the given array of cuts to enforce a maximum parallelism constraint
- *  w.r.t the given cut; moves filtered cuts to the end of the array and returns number of selected cuts */
+ *  w.r.t the given cut; moves filtered cuts to the end of the array and returns number of selected cuts
+ *
+ *  The exact parallelism is only computed for cuts for which the bound from the parallelism signatures does not
+ *  already show that the maximum parallelism is satisfied.
+ */
 static
 int filterWithParallelism(
    SCIP_ROW*             cut,                /**< cut to filter orthogonality with */
+   uint64_t              cutsignature,       /**< parallelism signature of the cut to filter orthogonality with */
+   SCIP_Real*            cutsqrnormfracs,    /**< squared norm fractions of the signature of the cut */
    SCIP_ROW**            cuts,               /**< array with cuts to perform selection algorithm */
    SCIP_Real*            scores,             /**< array with scores of cuts to perform selection algorithm */
+   int*                  slots,              /**< array with positions of the parallelism signatures of cuts */
+   uint64_t*             signatures,         /**< parallelism signatures of all cuts, indexed by slot */
+   SCIP_Real*            sqrnormfracs,       /**< squared norm fractions of all cuts, indexed by slot */
    int                   ncuts,              /**< number of cuts in given array */
    SCIP_Real             maxparallel         /**< maximal parallelism for all cuts that are not good */
    )
@@ -372,6 +383,10 @@ int filterWithParallelism(
    {
       SCIP_Real thisparallel;
 
+      if( SCIPgetParallelismSignatureBound(cutsignature, cutsqrnormfracs, signatures[slots[i]],
+            &sqrnormfracs[slots[i] * SCIP_PARALLELSIGNATURE_SIZE]) <= maxparallel )
+         continue;
+
       thisparallel = SCIProwGetParallelism(cut, cuts[i], 'e');
 
       if( thisparallel > maxparallel )
@@ -379,6 +394,7 @@ int filterWithParallelism(
          --ncuts;
          SCIPswapPointers((void**) &cuts[i], (void**) &cuts[ncuts]);
          SCIPswapReals(&scores[i], &scores[ncuts]);
+         SCIPswapInts(&slots[i], &slots[ncuts]);
       }
    }
 
@@ -390,21 +406,35 @@ static
 int penaliseWithParallelism(
    SCIP*                 scip,               /**< SCIP data structure */
    SCIP_ROW*             cut,                /**< cut to filter orthogonality with */
+   uint64_t              cutsignature,       /**< parallelism signature of the cut to filter orthogonality with */
+   SCIP_Real*            cutsqrnormfracs,    /**< squared norm fractions of the signature of the cut */
    SCIP_ROW**            cuts,               /**< array with cuts to perform selection algorithm */
    SCIP_Real*            scores,             /**< array with scores of cuts to perform selection algorithm */
+   int*                  slots,              /**< array with positions of the parallelism signatures of cuts */
+   uint64_t*             signatures,         /**< parallelism signatures of all cuts, indexed by slot */
+   SCIP_Real*            sqrnormfracs,       /**< squared norm fractions of all cuts, indexed by slot */
    int                   ncuts,              /**< number of cuts in given array */
    SCIP_Real             maxparallel,        /**< maximal parallelism for all cuts that are not good */
    SCIP_Real             paralpenalty        /**< penalty for weaker of two parallel cuts if penalising parallel cuts */
    )
 {
+   SCIP_Real minparallel;
+
    assert( cut != NULL );
    assert( ncuts == 0 || cuts != NULL );
    assert( ncuts == 0 || scores != NULL );
 
+   /* cuts with a smaller parallelism are neither filtered nor penalised */
+   minparallel = MIN(maxparallel, 1 - SCIPsumepsilon(scip));
+
    for( int i = ncuts - 1; i >= 0; --i )
    {
       SCIP_Real thisparallel;
 
+      if( SCIPgetParallelismSignatureBound(cutsignature, cutsqrnormfracs, signatures[slots[i]],
+            &sqrnormfracs[slots[i] * SCIP_PARALLELSIGNATURE_SIZE]) <= minparallel )
+         continue;
+
       thisparallel = SCIProwGetParallelism(cut, cuts[i], 'e');
 
       /* Filter cuts that are absolutely parallel still. Otherwise penalise if closely parallel */
@@ -413,6 +443,7 @@ int penaliseWithParallelism(
          --ncuts;
          SCIPswapPointers((void**) &cuts[i], (void**) &cuts[ncuts]);
          SCIPswapReals(&scores[i], &scores[ncuts]);
+         SCIPswapInts(&slots[i], &slots[ncuts]);
       }
       else if( thisparallel > maxparallel )
       {
@@ -429,6 +460,7 @@ static
 int filterWithDensity(
    SCIP*                 scip,               /**< SCIP data structure */
    SCIP_ROW**            cuts,               /**< array with cuts to perform selection algorithm */
+   int*                  slots,              /**< array with positions of the parallelism signatures of cuts, or NULL */
    SCIP_Real             maxdensity,         /**< maximum density s.t. a cut is not filtered */
    int                   ncuts               /**< number of cuts in given array */
    )
@@ -449,6 +481,8 @@ int filterWithDensity(
       {
          --ncuts;
          SCIPswapPointers((void**) &cuts[i], (void**) &cuts[ncuts]);
+         if( slots != NULL )
+            SCIPswapInts(&slots[i], &slots[ncuts]);
       }
    }
 
@@ -692,6 +726,11 @@ SCIP_RETCODE SCIPselectCutsEnsemble(
 {
    SCIP_Real* scores;
    SCIP_Real* origscoresptr;
+   SCIP_Real* sqrnormfracs;
+   SCIP_Real* forcedsqrnormfracs;
+   uint64_t* signatures;
+   int* slots;
+   int* origslotsptr;
    SCIP_Real nonzerobudget;
    SCIP_Real budgettaken = 0.0;
    SCIP_Real ncols;
@@ -706,7 +745,7 @@ SCIP_RETCODE SCIPselectCutsEnsemble(
    /* filter dense cuts */
    if( cutseldata->filterdensecuts )
    {
-      ncuts = filterWithDensity(scip, cuts, cutseldata->maxcutdensity, ncuts);
+      ncuts = filterWithDensity(scip, cuts, NULL, cutseldata->maxcutdensity, ncuts);
       if( ncuts == 0 )
          return SCIP_OKAY;
    }
@@ -718,15 +757,38 @@ SCIP_RETCODE SCIPselectCutsEnsemble(
    /* compute scores of cuts */
    SCIP_CALL( scoring(scip, cuts, cutseldata, scores, root, ncuts) );
 
+   /* compute the parallelism signatures of the cuts in contiguous arrays; the cuts refer to them by their slots */
+   SCIP_CALL( SCIPallocBufferArray(scip, &slots, ncuts) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &signatures, ncuts) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &sqrnormfracs, ncuts * SCIP_PARALLELSIGNATURE_SIZE) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &forcedsqrnormfracs, SCIP_PARALLELSIGNATURE_SIZE) );
+   origslotsptr = slots;
+
+   for( int i = 0; i < ncuts; ++i )
+   {
+      slots[i] = i;
+      if( cutseldata->filterparalcuts || cutseldata->penaliseparalcuts )
+         SCIProwGetParallelismSignature(cuts[i], &signatures[i], &sqrnormfracs[i * SCIP_PARALLELSIGNATURE_SIZE]);
+   }
+
    /* perform cut selection algorithm for the cuts */
 
    /* forced cuts are going to be selected so use them to filter cuts */
    for( int i = 0; i < nforcedcuts && ncuts > 0; ++i )
    {
+      uint64_t forcedsignature;
+
+      if( !cutseldata->filterparalcuts && !cutseldata->penaliseparalcuts )
+         break;
+
+      SCIProwGetParallelismSignature(forcedcuts[i], &forcedsignature, forcedsqrnormfracs);
+
       if( cutseldata->filterparalcuts )
-         ncuts = filterWithParallelism(forcedcuts[i], cuts, scores, ncuts, cutseldata->maxparal);
-      else if( cutseldata->penaliseparalcuts )
-         ncuts = penaliseWithParallelism(scip, forcedcuts[i], cuts, scores, ncuts, cutseldata->maxparal, cutseldata->paralpenalty);
+         ncuts = filterWithParallelism(forcedcuts[i], forcedsignature, forcedsqrnormfracs, cuts, scores, slots,
+            signatures, sqrnormfracs, ncuts, cutseldata->maxparal);
+      else
+         ncuts = penaliseWithParallelism(scip, forcedcuts[i], forcedsignature, forcedsqrnormfracs, cuts, scores, slots,
+            signatures, sqrnormfracs, ncuts, cutseldata->maxparal, cutseldata->paralpenalty);
    }
 
    /* Get the budget depending on if we are the root or not */
@@ -736,9 +798,11 @@ SCIP_RETCODE SCIPselectCutsEnsemble(
    while( ncuts > 0 )
    {
       SCIP_ROW* selectedcut;
+      int selectedslot;
 
-      selectBestCut(cuts, scores, ncuts);
+      selectBestCut(cuts, scores, slots, ncuts);
       selectedcut = cuts[0];
+      selectedslot = slots[0];
 
       /* if the best cut of the remaining cuts is considered bad, we discard it and all remaining cuts */
       if( scores[0] < cutseldata->minscore )
@@ -756,18 +820,27 @@ SCIP_RETCODE SCIPselectCutsEnsemble(
       /* move the pointers to the next position and filter the remaining cuts to enforce the maximum parallelism constraint */
       ++cuts;
       ++scores;
+      ++slots;
       --ncuts;
 
       if( cutseldata->filterparalcuts && ncuts > 0)
-         ncuts = filterWithParallelism(selectedcut, cuts, scores, ncuts, cutseldata->maxparal);
+         ncuts = filterWithParallelism(selectedcut, signatures[selectedslot],
+            &sqrnormfracs[selectedslot * SCIP_PARALLELSIGNATURE_SIZE], cuts, scores, slots, signatures, sqrnormfracs,
+            ncuts, cutseldata->maxparal);
       else if( cutseldata->penaliseparalcuts && ncuts > 0 )
-         ncuts = penaliseWithParallelism(scip, selectedcut, cuts, scores, ncuts, cutseldata->maxparal, cutseldata->paralpenalty);
+         ncuts = penaliseWithParallelism(scip, selectedcut, signatures[selectedslot],
+            &sqrnormfracs[selectedslot * SCIP_PARALLELSIGNATURE_SIZE], cuts, scores, slots, signatures, sqrnormfracs,
+            ncuts, cutseldata->maxparal, cutseldata->paralpenalty);
 
       /* Filter out all remaining cuts that would go over the non-zero budget threshold */
       if( nonzerobudget - budgettaken < 1 && ncuts > 0 )
-         ncuts = filterWithDensity(scip, cuts, nonzerobudget - budgettaken, ncuts);
+         ncuts = filterWithDensity(scip, cuts, slots, nonzerobudget - budgettaken, ncuts);
    }
 
+   SCIPfreeBufferArray(scip, &forcedsqrnormfracs);
+   SCIPfreeBufferArray(scip, &sqrnormfracs);
+   SCIPfreeBufferArray(scip, &signatures);
+   SCIPfreeBufferArray(scip, &origslotsptr);
    SCIPfreeBufferArray(scip, &origscoresptr);
 
    return SCIP_OKAY;
@@ -201,6 +201,7 @@ static
 void selectBestCut(
    SCIP_ROW**            cuts,               /**< array with cuts to perform selection algorithm */
    SCIP_Real*            scores,             /**< array with scores of cuts to perform selection algorithm */
+   int*                  slots,              /**< array with positions of the parallelism signatures of cuts */
    int                   ncuts               /**< number of cuts in given array */
    )
 {
@@ -226,15 +227,25 @@ void selectBestCut(
 
    SCIPswapPointers((void**) &cuts[bestpos], (void**) &cuts[0]);
    SCIPswapReals(&scores[bestpos], &scores[0]);
+   SCIPswapInts(&slots[bestpos], &slots[0]);
 }
 
 /** filters the given array of cuts to enforce a maximum parallelism constraint
- *  w.r.t the given cut; moves filtered cuts to the end of the array and returns number of selected cuts */
+ *  w.r.t the given cut; moves filtered cuts to the end of the array and returns number of selected cuts
+ *
+ *  The exact parallelism is only computed for cuts for which the bound from the parallelism signatures does not
+ *  already show that the maximum parallelism is satisfied.
+ */
 static
 int filterWithParallelism(
    SCIP_ROW*             cut,                /**< cut to filter orthogonality with */
+   uint64_t              cutsignature,       /**< parallelism signature of the cut to filter orthogonality with */
+   SCIP_Real*            cutsqrnormfracs,    /**< squared norm fractions of the signature of the cut */
    SCIP_ROW**            cuts,               /**< array with cuts to perform selection algorithm */
    SCIP_Real*            scores,             /**< array with scores of cuts to perform selection algorithm */
+   int*                  slots,              /**< array with positions of the parallelism signatures of cuts */
+   uint64_t*             signatures,         /**< parallelism signatures of all cuts, indexed by slot */
+   SCIP_Real*            sqrnormfracs,       /**< squared norm fractions of all cuts, indexed by slot */
    int                   ncuts,              /**< number of cuts in given array */
    SCIP_Real             goodscore,          /**< threshold for the score to be considered a good cut */
    SCIP_Real             goodmaxparall,      /**< maximal parallelism for good cuts */
@@ -252,14 +263,20 @@ int filterWithParallelism(
       SCIP_Real thisparall;
       SCIP_Real thismaxparall;
 
-      thisparall = SCIProwGetParallelism(cut, cuts[i], 'e');
       thismaxparall = scores[i] >= goodscore ? goodmaxparall : maxparall;
 
+      if( SCIPgetParallelismSignatureBound(cutsignature, cutsqrnormfracs, signatures[slots[i]],
+            &sqrnormfracs[slots[i] * SCIP_PARALLELSIGNATURE_SIZE]) <= thismaxparall )
+         continue;
+
+      thisparall = SCIProwGetParallelism(cut, cuts[i], 'e');
+
       if( thisparall > thismaxparall )
       {
          --ncuts;
          SCIPswapPointers((void**) &cuts[i], (void**) &cuts[ncuts]);
          SCIPswapReals(&scores[i], &scores[ncuts]);
+         SCIPswapInts(&slots[i], &slots[ncuts]);
       }
    }
 
@@ -458,6 +475,11 @@ SCIP_RETCODE SCIPselectCutsHybrid(
 {
    SCIP_Real* scores;
    SCIP_Real* scoresptr;
+   SCIP_Real* sqrnormfracs;
+   SCIP_Real* forcedsqrnormfracs;
+   uint64_t* signatures;
+   int* slots;
+   int* slotsptr;
    SCIP_Real maxforcedscores;
    SCIP_Real maxnonforcedscores;
    SCIP_Real goodscore;
@@ -482,22 +504,41 @@ SCIP_RETCODE SCIPselectCutsHybrid(
    badscore = goodscore * badscorefac;
    goodscore *= goodscorefac;
 
+   /* compute the parallelism signatures of the cuts in contiguous arrays; the cuts refer to them by their slots */
+   SCIP_CALL( SCIPallocBufferArray(scip, &slots, ncuts) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &signatures, ncuts) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &sqrnormfracs, ncuts * SCIP_PARALLELSIGNATURE_SIZE) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &forcedsqrnormfracs, SCIP_PARALLELSIGNATURE_SIZE) );
+
+   for( i = 0; i < ncuts; ++i )
+   {
+      slots[i] = i;
+      SCIProwGetParallelismSignature(cuts[i], &signatures[i], &sqrnormfracs[i * SCIP_PARALLELSIGNATURE_SIZE]);
+   }
+
    /* perform cut selection algorithm for the cuts */
 
    /* forced cuts are going to be selected so use them to filter cuts */
    for( i = 0; i < nforcedcuts && ncuts > 0; ++i )
    {
-      ncuts = filterWithParallelism(forcedcuts[i], cuts, scores, ncuts, goodscore, goodmaxparall, maxparall);
+      uint64_t forcedsignature;
+
+      SCIProwGetParallelismSignature(forcedcuts[i], &forcedsignature, forcedsqrnormfracs);
+      ncuts = filterWithParallelism(forcedcuts[i], forcedsignature, forcedsqrnormfracs, cuts, scores, slots,
+         signatures, sqrnormfracs, ncuts, goodscore, goodmaxparall, maxparall);
    }
 
    /* now greedily select the remaining cuts */
    scoresptr = scores;
+   slotsptr = slots;
    while( ncuts > 0 )
    {
       SCIP_ROW* selectedcut;
+      int selectedslot;
 
-      selectBestCut(cuts, scores, ncuts);
+      selectBestCut(cuts, scores, slots, ncuts);
       selectedcut = cuts[0];
+      selectedslot = slots[0];
 
       /* if the best cut of the remaining cuts is considered bad, we discard it and all remaining cuts */
       if( scores[0] < badscore )
@@ -512,11 +553,18 @@ SCIP_RETCODE SCIPselectCutsHybrid(
       /* move the pointers to the next position and filter the remaining cuts to enforce the maximum parallelism constraint */
       ++cuts;
       ++scores;
+      ++slots;
       --ncuts;
 
-      ncuts = filterWithParallelism(selectedcut, cuts, scores, ncuts, goodscore, goodmaxparall, maxparall);
+      ncuts = filterWithParallelism(selectedcut, signatures[selectedslot],
+         &sqrnormfracs[selectedslot * SCIP_PARALLELSIGNATURE_SIZE], cuts, scores, slots, signatures, sqrnormfracs,
+         ncuts, goodscore, goodmaxparall, maxparall);
    }
 
+   SCIPfreeBufferArray(scip, &forcedsqrnormfracs);
+   SCIPfreeBufferArray(scip, &sqrnormfracs);
+   SCIPfreeBufferArray(scip, &signatures);
+   SCIPfreeBufferArray(scip, &slotsptr);
    SCIPfreeBufferArray(scip, &scoresptr);
 
    return SCIP_OKAY;
@@ -35,7 +35,11 @@
 
 #include "scip/heur_adaptivediving.h"
 #include "scip/heuristics.h"
+#include "scip/scip_concurrent.h"
 #include "scip/scipdefplugins.h"
+#include "scip/syncstore.h"
+#include "tpi/tpi.h"
+#include "tpi/def_openmp.h"
 
 #define HEUR_NAME             "adaptivediving"
 #define HEUR_DESC             "diving heuristic that selects adaptively between the existing, public divesets"
@@ -63,6 +67,7 @@
 #define DEFAULT_MAXLPITERQUOT       0.1      /**< maximal fraction of diving LP iterations compared to node LP iterations */
 #define DEFAULT_MAXLPITEROFS      1500L      /**< additional number of allowed LP iterations */
 #define DEFAULT_BESTSOLWEIGHT      10.0      /**< weight of incumbent solutions compared to other solutions in computation of LP iteration limit */
+#define DEFAULT_NTHREADS              1      /**< number of threads to dive with several divesets in parallel in sub-SCIPs */
 
 /* locally defined heuristic data */
 struct SCIP_HeurData
@@ -85,8 +90,21 @@ struct SCIP_HeurData
                                                *  backtrack/'c'onflict ratio, 'd'epth, 1 / 's'olutions, or
                                                *  1 / solutions'u'ccess */
    SCIP_Bool             useadaptivecontext; /**< should the heuristic use its own statistics, or shared statistics? */
+   int                   nthreads;           /**< number of threads to dive with several divesets in parallel in sub-SCIPs */
+   int                   nparallelcalls;     /**< number of calls that dived with several divesets in parallel */
 };
 
+/** dive of one diveset in a sub-SCIP copy of the current node, which is solved on a worker thread */
+struct DiveJob
+{
+   SCIP*                 subscip;            /**< sub-SCIP in which the diving heuristic of the diveset runs at the root */
+   SCIP_VAR**            subvars;            /**< sub-SCIP variables in the order of the variables of the main SCIP */
+   SCIP_DIVESET*         diveset;            /**< diveset of the main SCIP */
+   SCIP_RETCODE          retcode;            /**< return code of solving the sub-SCIP */
+   SCIP_Bool             solve;              /**< could the diving heuristic of the diveset be set up in the sub-SCIP? */
+};
+typedef struct DiveJob DIVEJOB;
+
 /*
  * local methods
  */
@@ -246,6 +264,7 @@ SCIP_DECL_HEURINIT(heurInitAdaptivediving) /*lint --e{715}*/
    /* get and reset heuristic data */
    heurdata = SCIPheurGetData(heur);
    heurdata->lastselection = -1;
+   heurdata->nparallelcalls = 0;
    if( heurdata->divesets != NULL )
    {
       /* we clear the list of collected divesets to ensure reproducability and consistent state across multiple runs
@@ -387,18 +406,20 @@ int sampleWeighted(
    return w;
 }
 
-/** select the diving method to apply */
+/** select the diving method to apply, or -1 if no diveset is available */
 static
 SCIP_RETCODE selectDiving(
    SCIP*                 scip,               /**< SCIP data structure */
    SCIP_HEUR*            heur,               /**< the heuristic */
    SCIP_HEURDATA*        heurdata,           /**< heuristic data */
+   SCIP_Bool*            excluded,           /**< array marking divesets that must not be selected, or NULL */
    int*                  selection           /**< selection made */
    )
 {
    SCIP_Bool* methodunavailable;
    SCIP_DIVESET** divesets;
    int ndivesets;
+   int navailable;
    int d;
    SCIP_RANDNUMGEN* rng;
    SCIP_DIVECONTEXT divecontext;
@@ -415,15 +436,32 @@ SCIP_RETCODE selectDiving(
    divecontext = heurdata->useadaptivecontext ? SCIP_DIVECONTEXT_ADAPTIVE : SCIP_DIVECONTEXT_TOTAL;
 
    /* check availability of divesets */
+   navailable = 0;
    for( d = 0; d < heurdata->ndivesets; ++d )
    {
       SCIP_Bool available;
+
+      if( excluded != NULL && excluded[d] )
+      {
+         methodunavailable[d] = TRUE;
+         continue;
+      }
+
       SCIP_CALL( SCIPisDivesetAvailable(scip, heurdata->divesets[d], &available) );
       methodunavailable[d] = ! available;
+
+      if( available )
+         ++navailable;
    }
 
    *selection = -1;
 
+   if( navailable == 0 )
+   {
+      SCIPfreeBufferArray(scip, &methodunavailable);
+      return SCIP_OKAY;
+   }
+
    rng = heurdata->randnumgen;
    assert(rng != NULL);
 
@@ -501,6 +539,325 @@ SCIP_RETCODE selectDiving(
    return SCIP_OKAY;
 }
 
+/** creates the sub-SCIP of a dive as a local copy of the current node, in which only the diving heuristic of the
+ *  diveset is run at the root node
+ */
+static
+SCIP_RETCODE createDiveSubscip(
+   SCIP*                 scip,               /**< SCIP data structure */
+   DIVEJOB*              divejob,            /**< dive with the diveset to apply */
+   SCIP_Longint          lpiterlimit,        /**< LP iteration limit of the dive */
+   int                   njobs               /**< number of dives that are run concurrently */
+   )
+{
+   char paramname[SCIP_MAXSTRLEN];
+   SCIP_HASHMAP* varmap;
+   SCIP_VAR** vars;
+   SCIP_RETCODE retcode;
+   const char* heurname;
+   const char* divesetname;
+   SCIP_Real memorylimit;
+   int nvars;
+   int i;
+
+   assert(divejob != NULL);
+   assert(divejob->diveset != NULL);
+
+   divejob->solve = FALSE;
+
+   SCIP_CALL( SCIPgetVarsData(scip, &vars, &nvars, NULL, NULL, NULL, NULL) );
+
+   /* the sub-SCIP is solved on another thread, so it gets its own message handler and a thread safe copy */
+   SCIP_CALL( SCIPcreate(&divejob->subscip) );
+   SCIPsetMessagehdlrQuiet(divejob->subscip, SCIPmessagehdlrIsQuiet(SCIPgetMessagehdlr(scip)));
+   SCIP_CALL( SCIPhashmapCreate(&varmap, SCIPblkmem(divejob->subscip), nvars) );
+
+   retcode = SCIP_OKAY;
+
+   /* the local copy contains the bounds and constraints of the current node */
+   SCIP_CALL_TERMINATE( retcode, SCIPcopyConsCompression(scip, divejob->subscip, varmap, NULL, HEUR_NAME, NULL, NULL, 0,
+         FALSE, FALSE, TRUE, FALSE, NULL), TERMINATE );
+
+   SCIP_CALL_TERMINATE( retcode, SCIPallocBlockMemoryArray(scip, &divejob->subvars, nvars), TERMINATE );
+   for( i = 0; i < nvars; ++i )
+      divejob->subvars[i] = (SCIP_VAR*) SCIPhashmapGetImage(varmap, vars[i]);
+
+TERMINATE:
+   /* the sub-SCIP is freed by the caller also if the copy failed */
+   SCIPhashmapFree(&varmap);
+   SCIP_CALL( retcode );
+
+   /* the CPU time of the process advances with all threads, so the time limits refer to the wall clock time */
+   SCIP_CALL( SCIPsetBoolParam(divejob->subscip, "misc/catchctrlc", FALSE) );
+   SCIP_CALL( SCIPsetIntParam(divejob->subscip, "timing/clocktype", (int)SCIP_CLOCKTYPE_WALL) );
+   SCIP_CALL( SCIPsetIntParam(divejob->subscip, "display/verblevel", 0) );
+   SCIP_CALL( SCIPsetBoolParam(divejob->subscip, "timing/statistictiming", FALSE) );
+
+   /* the dives share the remaining memory */
+   SCIP_CALL( SCIPcopyLimits(scip, divejob->subscip) );
+   SCIP_CALL( SCIPgetRealParam(divejob->subscip, "limits/memory", &memorylimit) );
+   if( !SCIPisInfinity(scip, memorylimit) )
+   {
+      SCIP_CALL( SCIPsetRealParam(divejob->subscip, "limits/memory", memorylimit / njobs) );
+   }
+   SCIP_CALL( SCIPsetLongintParam(divejob->subscip, "limits/nodes", 1LL) );
+
+   /* only the diving heuristic of the diveset runs in the sub-SCIP, and only at the root node */
+   SCIP_CALL( SCIPsetSubscipsOff(divejob->subscip, TRUE) );
+   SCIP_CALL( SCIPsetHeuristics(divejob->subscip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetSeparating(divejob->subscip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetPresolving(divejob->subscip, SCIP_PARAMSETTING_FAST, TRUE) );
+
+   heurname = SCIPheurGetName(SCIPdivesetGetHeur(divejob->diveset));
+   divesetname = SCIPdivesetGetName(divejob->diveset);
+
+   (void) SCIPsnprintf(paramname, SCIP_MAXSTRLEN, "heuristics/%s/freq", heurname);
+   if( SCIPfindHeur(divejob->subscip, heurname) == NULL || SCIPisParamFixed(divejob->subscip, paramname) )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPsetIntParam(divejob->subscip, paramname, 0) );
+   (void) SCIPsnprintf(paramname, SCIP_MAXSTRLEN, "heuristics/%s/freqofs", heurname);
+   SCIP_CALL( SCIPsetIntParam(divejob->subscip, paramname, 0) );
+
+   /* the dive gets the LP iteration limit of the adaptive diving heuristic */
+   (void) SCIPsnprintf(paramname, SCIP_MAXSTRLEN, "heuristics/%s/maxlpiterquot", divesetname);
+   SCIP_CALL( SCIPsetRealParam(divejob->subscip, paramname, 0.0) );
+   (void) SCIPsnprintf(paramname, SCIP_MAXSTRLEN, "heuristics/%s/maxlpiterofs", divesetname);
+   SCIP_CALL( SCIPsetIntParam(divejob->subscip, paramname, (int)MIN(lpiterlimit, (SCIP_Longint)INT_MAX)) );
+
+   /* only improving solutions are of interest */
+   if( SCIPgetNSols(scip) > 0 )
+   {
+      SCIP_CALL( SCIPsetObjlimit(divejob->subscip, SCIPgetUpperbound(scip) - SCIPsumepsilon(scip)) );
+   }
+
+   divejob->solve = TRUE;
+
+   return SCIP_OKAY;
+}
+
+/** job function solving the root node of the sub-SCIP of a dive on a worker thread */
+static
+SCIP_RETCODE solveDiveJob(
+   void*                 args                /**< the dive of type DIVEJOB */
+   )
+{
+   DIVEJOB* divejob;
+
+   divejob = (DIVEJOB*)args;
+   assert(divejob != NULL);
+   assert(divejob->subscip != NULL);
+
+   /* errors in a sub-SCIP should not stop the main SCIP, they are reported after all dives finished */
+   divejob->retcode = SCIPsolve(divejob->subscip);
+
+   return SCIP_OKAY;
+}
+
+/** frees the sub-SCIPs of the dives */
+static
+SCIP_RETCODE freeDiveJobs(
+   SCIP*                 scip,               /**< SCIP data structure */
+   DIVEJOB*              divejobs,           /**< dives */
+   int                   njobs               /**< number of dives */
+   )
+{
+   int j;
+
+   for( j = 0; j < njobs; ++j )
+   {
+      if( divejobs[j].subvars != NULL )
+      {
+         SCIPfreeBlockMemoryArray(scip, &divejobs[j].subvars, SCIPgetNVars(scip));
+      }
+      if( divejobs[j].subscip != NULL )
+      {
+         SCIP_CALL( SCIPfree(&divejobs[j].subscip) );
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
+/** dives with several divesets concurrently on the task processing interface
+ *
+ *  Up to nthreads different divesets are selected by the selection strategy. Each of them dives in a local copy of the
+ *  current node, which has its own LP and domains and in which only the diving heuristic of the diveset is run at the
+ *  root node. The copies are created sequentially, since copying accesses the main SCIP. Afterwards, the solutions are
+ *  transferred and the statistics of the divesets are updated in the order of the selection, so the result does not
+ *  depend on the order in which the dives finish.
+ */
+static
+SCIP_RETCODE performDivingParallel(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_HEUR*            heur,               /**< the heuristic */
+   SCIP_HEURDATA*        heurdata,           /**< heuristic data */
+   SCIP_Longint          lpiterlimit,        /**< LP iteration limit of each dive */
+   SCIP_RESULT*          result              /**< pointer to store the result */
+   )
+{
+   DIVEJOB* divejobs;
+   SCIP_Bool* selected;
+   SCIP_RETCODE retcode;
+   SCIP_Bool success;
+   int njobs;
+   int jobid;
+   int j;
+
+   assert(heurdata->nthreads > 1);
+
+   SCIP_CALL( SCIPcheckCopyLimits(scip, &success) );
+   if( !success )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &divejobs, heurdata->nthreads) );
+   SCIP_CALL( SCIPallocClearBufferArray(scip, &selected, heurdata->ndivesets) );
+
+   /* select different divesets for the dives */
+   njobs = 0;
+   while( njobs < heurdata->nthreads )
+   {
+      int selection;
+
+      SCIP_CALL( selectDiving(scip, heur, heurdata, selected, &selection) );
+
+      if( selection < 0 )
+         break;
+
+      selected[selection] = TRUE;
+      divejobs[njobs].diveset = heurdata->divesets[selection];
+      divejobs[njobs].subscip = NULL;
+      divejobs[njobs].subvars = NULL;
+      divejobs[njobs].retcode = SCIP_OKAY;
+      divejobs[njobs].solve = FALSE;
+      ++njobs;
+   }
+
+   SCIPfreeBufferArray(scip, &selected);
+
+   retcode = SCIP_OKAY;
+
+   if( njobs == 0 )
+      goto TERMINATE;
+
+   for( j = 0; j < njobs; ++j )
+   {
+      SCIP_CALL_TERMINATE( retcode, createDiveSubscip(scip, &divejobs[j], lpiterlimit, njobs), TERMINATE );
+   }
+
+   SCIPdebugMsg(scip, "diving with %d divesets in parallel\n", njobs);
+
+   SCIP_CALL_TERMINATE( retcode, SCIPtpiInit(njobs, INT_MAX, FALSE), TERMINATE );
+
+   jobid = SCIPtpiGetNewJobID();
+
+   TPI_PARA
+   {
+      TPI_SINGLE
+      {
+         for( j = 0; j < njobs; ++j )
+         {
+            /* cppcheck-suppress unassignedVariable */
+            SCIP_JOB* job;
+            SCIP_SUBMITSTATUS status;
+
+            if( !divejobs[j].solve )
+               continue;
+
+            SCIP_CALL_ABORT( SCIPtpiCreateJob(&job, jobid, solveDiveJob, &divejobs[j]) );
+            SCIP_CALL_ABORT( SCIPtpiSubmitJob(job, &status) );
+
+            assert(status == SCIP_SUBMIT_SUCCESS);
+         }
+      }
+   }
+
+   retcode = SCIPtpiCollectJobs(jobid);
+
+   if( retcode == SCIP_OKAY )
+      retcode = SCIPtpiExit();
+   else
+      (void) SCIPtpiExit();
+
+   if( retcode != SCIP_OKAY )
+      goto TERMINATE;
+
+   *result = SCIP_DIDNOTFIND;
+   ++heurdata->nparallelcalls;
+
+   /* transfer the solutions and the statistics in the order of the selection */
+   for( j = 0; j < njobs; ++j )
+   {
+      SCIP_DIVESET* subdiveset;
+      SCIP_HEUR* subheur;
+      SCIP_Longint oldnsolsfound;
+      SCIP_Longint oldnbestsolsfound;
+      int d;
+
+      if( !divejobs[j].solve )
+         continue;
+
+      if( divejobs[j].retcode != SCIP_OKAY )
+      {
+         SCIPwarningMessage(scip, "Error while diving with diveset <%s> in sub-SCIP; sub-SCIP terminated with code <%d>\n",
+            SCIPdivesetGetName(divejobs[j].diveset), divejobs[j].retcode);
+         continue;
+      }
+
+      oldnsolsfound = SCIPgetNSolsFound(scip);
+      oldnbestsolsfound = SCIPgetNBestSolsFound(scip);
+
+      SCIP_CALL_TERMINATE( retcode, SCIPtranslateSubSols(scip, divejobs[j].subscip, heur, divejobs[j].subvars,
+            &success, NULL), TERMINATE );
+
+      if( success )
+         *result = SCIP_FOUNDSOL;
+
+      /* find the diveset in the sub-SCIP; it did not dive if its root LP was infeasible or integral */
+      subheur = SCIPfindHeur(divejobs[j].subscip, SCIPheurGetName(SCIPdivesetGetHeur(divejobs[j].diveset)));
+      assert(subheur != NULL);
+
+      subdiveset = NULL;
+      for( d = 0; d < SCIPheurGetNDivesets(subheur); ++d )
+      {
+         if( strcmp(SCIPdivesetGetName(SCIPheurGetDivesets(subheur)[d]), SCIPdivesetGetName(divejobs[j].diveset)) == 0 )
+         {
+            subdiveset = SCIPheurGetDivesets(subheur)[d];
+            break;
+         }
+      }
+
+      if( subdiveset == NULL || SCIPdivesetGetNCalls(subdiveset, SCIP_DIVECONTEXT_TOTAL) == 0 )
+         continue;
+
+      SCIPupdateDivesetLPStats(scip, divejobs[j].diveset, SCIPdivesetGetNLPIterations(subdiveset,
+            SCIP_DIVECONTEXT_TOTAL), SCIP_DIVECONTEXT_ADAPTIVE);
+
+      /* the dive started at the root of the sub-SCIP, which corresponds to the current node */
+      SCIPupdateDivesetStatsDepth(scip, divejobs[j].diveset,
+            SCIPgetDepth(scip) + SCIPdivesetGetMaxDepth(subdiveset, SCIP_DIVECONTEXT_TOTAL),
+            (int)SCIPdivesetGetNProbingNodes(subdiveset, SCIP_DIVECONTEXT_TOTAL),
+            (int)SCIPdivesetGetNBacktracks(subdiveset, SCIP_DIVECONTEXT_TOTAL),
+            SCIPgetNSolsFound(scip) - oldnsolsfound, SCIPgetNBestSolsFound(scip) - oldnbestsolsfound,
+            SCIPdivesetGetNConflicts(subdiveset, SCIP_DIVECONTEXT_TOTAL),
+            SCIPdivesetGetNSolutionCalls(subdiveset, SCIP_DIVECONTEXT_TOTAL) > 0, SCIP_DIVECONTEXT_ADAPTIVE);
+
+      SCIPdebugMsg(scip, "diveset %s: %" SCIP_LONGINT_FORMAT " probing nodes, success=%u\n",
+         SCIPdivesetGetName(divejobs[j].diveset), SCIPdivesetGetNProbingNodes(subdiveset, SCIP_DIVECONTEXT_TOTAL),
+         success);
+   }
+
+TERMINATE:
+   if( retcode == SCIP_OKAY )
+      retcode = freeDiveJobs(scip, divejobs, njobs);
+   else
+      (void) freeDiveJobs(scip, divejobs, njobs);
+
+   SCIPfreeBufferArray(scip, &divejobs);
+
+   return retcode;
+}
+
 /** execution method of primal heuristic */
 static
 SCIP_DECL_HEUREXEC(heurExecAdaptivediving) /*lint --e{715}*/
@@ -568,9 +925,21 @@ SCIP_DECL_HEUREXEC(heurExecAdaptivediving) /*lint --e{715}*/
    if( lpiterlimit <= 0 )
       return SCIP_OKAY;
 
+   /* dive with several divesets in parallel, if possible; this is not done in sub-SCIPs and in concurrent mode */
+   if( heurdata->nthreads > 1 && SCIPgetSubscipDepth(scip) == 0 && SCIPtpiIsAvailable()
+      && !SCIPsyncstoreIsInitialized(SCIPgetSyncstore(scip)) )
+   {
+      SCIP_CALL( performDivingParallel(scip, heur, heurdata, lpiterlimit, result) );
+
+      return SCIP_OKAY;
+   }
+
    /* select the next diving strategy based on previous success */
-   SCIP_CALL( selectDiving(scip, heur, heurdata, &selection) );
-   assert(selection >= 0 && selection < heurdata->ndivesets);
+   SCIP_CALL( selectDiving(scip, heur, heurdata, NULL, &selection) );
+
+   if( selection < 0 )
+      return SCIP_OKAY;
+   assert(selection < heurdata->ndivesets);
 
    diveset = divesets[selection];
    assert(diveset != NULL);
@@ -604,6 +973,7 @@ SCIP_RETCODE SCIPincludeHeurAdaptivediving(
    heurdata->divesets = NULL;
    heurdata->ndivesets = 0;
    heurdata->divesetssize = -1;
+   heurdata->nparallelcalls = 0;
 
    SCIP_CALL_TERMINATE( retcode, SCIPcreateRandom(scip, &heurdata->randnumgen, DEFAULT_INITIALSEED, TRUE), TERMINATE );
 
@@ -654,6 +1024,10 @@ SCIP_RETCODE SCIPincludeHeurAdaptivediving(
          "weight of incumbent solutions compared to other solutions in computation of LP iteration limit",
          &heurdata->bestsolweight, FALSE, DEFAULT_BESTSOLWEIGHT, 0.0, SCIP_REAL_MAX, NULL, NULL) );
 
+   SCIP_CALL( SCIPaddIntParam(scip, "heuristics/" HEUR_NAME "/nthreads",
+         "maximum number of threads to dive with different divesets in parallel in sub-SCIPs of the current node",
+         &heurdata->nthreads, TRUE, DEFAULT_NTHREADS, 1, 64, NULL, NULL) );
+
 /* cppcheck-suppress unusedLabel */
 TERMINATE:
    if( retcode != SCIP_OKAY )
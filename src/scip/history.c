@@ -74,6 +74,43 @@ void SCIPhistoryFree(
    BMSfreeBlockMemory(blkmem, history);
 }
 
+/** creates the empty history entries over all runs and of the current run next to each other in one memory block, such
+ *  that the branching scores, which use both entries, access contiguous memory
+ */
+SCIP_RETCODE SCIPhistoryCreatePair(
+   SCIP_HISTORY**        history,            /**< pointer to store branching and inference history over all runs */
+   SCIP_HISTORY**        historycrun,        /**< pointer to store branching and inference history of the current run */
+   BMS_BLKMEM*           blkmem              /**< block memory */
+   )
+{
+   assert(history != NULL);
+   assert(historycrun != NULL);
+
+   SCIP_ALLOC( BMSallocBlockMemoryArray(blkmem, history, 2) );
+   *historycrun = &(*history)[1];
+
+   SCIPhistoryReset(*history);
+   SCIPhistoryReset(*historycrun);
+
+   return SCIP_OKAY;
+}
+
+/** frees history entries created by SCIPhistoryCreatePair() */
+void SCIPhistoryFreePair(
+   SCIP_HISTORY**        history,            /**< pointer to branching and inference history over all runs */
+   SCIP_HISTORY**        historycrun,        /**< pointer to branching and inference history of the current run */
+   BMS_BLKMEM*           blkmem              /**< block memory */
+   )
+{
+   assert(history != NULL);
+   assert(*history != NULL);
+   assert(historycrun != NULL);
+   assert(*historycrun == &(*history)[1]);
+
+   BMSfreeBlockMemoryArray(blkmem, history, 2);
+   *historycrun = NULL;
+}
+
 /** resets history entry to zero */
 void SCIPhistoryReset(
    SCIP_HISTORY*         history             /**< branching and inference history */
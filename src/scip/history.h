@@ -61,6 +61,22 @@ void SCIPhistoryFree(
    BMS_BLKMEM*           blkmem              /**< block memory */
    );
 
+/** creates the empty history entries over all runs and of the current run next to each other in one memory block, such
+ *  that the branching scores, which use both entries, access contiguous memory
+ */
+SCIP_RETCODE SCIPhistoryCreatePair(
+   SCIP_HISTORY**        history,            /**< pointer to store branching and inference history over all runs */
+   SCIP_HISTORY**        historycrun,        /**< pointer to store branching and inference history of the current run */
+   BMS_BLKMEM*           blkmem              /**< block memory */
+   );
+
+/** frees history entries created by SCIPhistoryCreatePair() */
+void SCIPhistoryFreePair(
+   SCIP_HISTORY**        history,            /**< pointer to branching and inference history over all runs */
+   SCIP_HISTORY**        historycrun,        /**< pointer to branching and inference history of the current run */
+   BMS_BLKMEM*           blkmem              /**< block memory */
+   );
+
 /** resets history entry to zero */
 void SCIPhistoryReset(
    SCIP_HISTORY*         history             /**< branching and inference history */
@@ -7781,6 +7781,98 @@ SCIP_Real SCIProwGetParallelism(
    return parallelism;
 }
 
+/** computes a 64 bit signature of the columns of the row together with, for each bit of the signature, the sum of the
+ *  squared coefficients of the columns mapped to this bit relative to the squared norm of the row;
+ *  the data of two rows can be passed to SCIPgetParallelismSignatureBound() to bound their euclidean parallelism
+ *  without merging the rows
+ */
+void SCIProwGetParallelismSignature(
+   SCIP_ROW*             row,                /**< LP row */
+   uint64_t*             signature,          /**< pointer to store the signature of the columns of the row */
+   SCIP_Real*            sqrnormfracs        /**< array of size SCIP_PARALLELSIGNATURE_SIZE to store the fraction of the
+                                              *   squared norm of the row for each bit of the signature */
+   )
+{
+   SCIP_Real sqrnorm;
+   int b;
+   int i;
+
+   assert(row != NULL);
+   assert(signature != NULL);
+   assert(sqrnormfracs != NULL);
+
+   sqrnorm = row->sqrnorm;
+
+   /* if the norm of the row is invalid, the parallelism has to be computed exactly, see SCIProwGetParallelism() */
+   if( sqrnorm <= 0.0 )
+   {
+      *signature = ~UINT64_C(0);
+      for( b = 0; b < SCIP_PARALLELSIGNATURE_SIZE; ++b )
+         sqrnormfracs[b] = SCIP_INVALID;
+      return;
+   }
+
+   *signature = 0;
+   BMSclearMemoryArray(sqrnormfracs, SCIP_PARALLELSIGNATURE_SIZE);
+
+   /* the scalar product only regards LP columns, but all columns are a valid superset for the bound */
+   for( i = 0; i < row->len; ++i )
+   {
+      /* the bit of the column as in SCIPhashSignature64(), which is the most significant bit shifted by b */
+      b = (int)((UINT32_C(0x9e3779b9) * (uint32_t)row->cols[i]->index) >> 26);
+      assert(0 <= b && b < SCIP_PARALLELSIGNATURE_SIZE);
+      assert(SCIPhashSignature64(row->cols[i]->index) == (UINT64_C(0x8000000000000000) >> b));
+
+      *signature |= UINT64_C(0x8000000000000000) >> b;
+      sqrnormfracs[b] += SQR(row->vals[i]) / sqrnorm;
+   }
+}
+
+/** returns an upper bound on the euclidean parallelism SCIProwGetParallelism(row1, row2, 'e') of two rows given their
+ *  parallelism signatures computed by SCIProwGetParallelismSignature();
+ *
+ *  The bound follows from the Cauchy-Schwarz inequality on the columns that may be common to both rows. It is zero if
+ *  the supports of the rows are disjoint and includes a safety margin for roundoff errors.
+ */
+SCIP_Real SCIPgetParallelismSignatureBound(
+   uint64_t              signature1,         /**< signature of the first row */
+   SCIP_Real*            sqrnormfracs1,      /**< squared norm fractions of the first row */
+   uint64_t              signature2,         /**< signature of the second row */
+   SCIP_Real*            sqrnormfracs2       /**< squared norm fractions of the second row */
+   )
+{
+   uint64_t common;
+   SCIP_Real sum1;
+   SCIP_Real sum2;
+   int b;
+
+   assert(sqrnormfracs1 != NULL);
+   assert(sqrnormfracs2 != NULL);
+
+   common = signature1 & signature2;
+
+   if( common == 0 )
+      return 0.0;
+
+   sum1 = 0.0;
+   sum2 = 0.0;
+
+   /* sum up the fractions of the bits that are set in both signatures, starting at the most significant bit */
+   for( b = 0; common != 0; ++b, common <<= 1 )
+   {
+      if( common & UINT64_C(0x8000000000000000) )
+      {
+         sum1 += sqrnormfracs1[b];
+         sum2 += sqrnormfracs2[b];
+      }
+   }
+
+   if( sum1 >= SCIP_INVALID || sum2 >= SCIP_INVALID )
+      return SCIP_INVALID;
+
+   return sqrt(sum1 * sum2) * (1.0 + 1e-9) + 1e-9;
+}
+
 /** returns the degree of orthogonality between the hyperplanes defined by the two row vectors v, w:
  *  o = 1 - |v*w|/(|v|*|w|);
  *  the hyperplanes are orthogonal, iff p = 1, they are parallel, iff p = 0
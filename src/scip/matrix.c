@@ -1210,7 +1210,13 @@ void SCIPmatrixRemoveColumnBounds(
    matrix->ub[col] = SCIPinfinity(scip);
 }
 
-/** detect parallel rows of matrix. rhs/lhs are ignored. */
+/** detect parallel rows of matrix. rhs/lhs are ignored.
+ *
+ *  The rows are partitioned into classes by the algorithm of Bixby and Wagner, see "A note on Detecting Simple
+ *  Redundancies in Linear Systems", June 1986: the classes are refined column by column according to the scaled
+ *  coefficients of the rows. Rows that are alone in their class cannot become parallel to any other row and are not
+ *  considered anymore, such that the sorting effort decreases quickly with the number of processed columns.
+ */
 SCIP_RETCODE SCIPmatrixGetParallelRows(
    SCIP*                 scip,               /**< SCIP instance */
    SCIP_MATRIX*          matrix,             /**< matrix containing the constraints */
@@ -1280,12 +1286,28 @@ SCIP_RETCODE SCIPmatrixGetParallelRows(
             scale[rowidx] = aij;
          assert(scale[rowidx] != 0.0);
 
-         rowindices[i] = rowidx;
-         values[i] = aij / scale[rowidx];
          pc = pclass[rowidx];
          assert(pc < matrix->nrows);
+         assert(classsizes[pc] > 0);
 
-         /* update class sizes and pclass set */
+         /* skip rows that are already alone in their class */
+         if( classsizes[pc] == 1 )
+            continue;
+
+         rowindices[i] = rowidx;
+         values[i] = aij / scale[rowidx];
+         pcs[i] = pc;
+
+         i++;
+      }
+
+      if( i == 0 )
+         continue;
+
+      /* update class sizes and pclass set */
+      for( k = 0; k < i; ++k )
+      {
+         pc = pcs[k];
          assert(classsizes[pc] > 0);
          classsizes[pc]--;
          if( classsizes[pc] == 0 )
@@ -1293,9 +1315,6 @@ SCIP_RETCODE SCIPmatrixGetParallelRows(
             assert(pcsetfill < matrix->nrows);
             pcset[pcsetfill++] = pc;
          }
-         pcs[i] = pc;
-
-         i++;
       }
 
       /* sort on the pclass values */
@@ -1350,7 +1369,7 @@ SCIP_RETCODE SCIPmatrixGetParallelRows(
                break;
          }
 
-         if( k == matrix->colmatcnt[c] )
+         if( k == i )
             break;
       }
    }
@@ -1364,8 +1383,10 @@ SCIP_RETCODE SCIPmatrixGetParallelRows(
    return SCIP_OKAY;
 }
 
-/** detect parallel rows of matrix.
- * obj coefficients are ignored.
+/** detect parallel columns of matrix within equations and ranged rows. obj coefficients are ignored.
+ *
+ *  The columns are partitioned into classes by the same refinement as in SCIPmatrixGetParallelRows(), where only the
+ *  rows with finite right hand side are used for the refinement.
  */
 SCIP_RETCODE SCIPmatrixGetParallelCols(
    SCIP*                 scip,               /**< SCIP instance */
@@ -1421,8 +1442,8 @@ SCIP_RETCODE SCIPmatrixGetParallelCols(
    /* loop over all rows */
    for( r = 0; r < matrix->nrows; ++r )
    {
-      /* we consider only equations or ranged rows */
-      if( !matrix->isrhsinfinite[r] )
+      /* we consider only non-empty equations or ranged rows */
+      if( !matrix->isrhsinfinite[r] && matrix->rowmatcnt[r] > 0 )
       {
          rowpnt = matrix->rowmatind + matrix->rowmatbeg[r];
          rowend = rowpnt + matrix->rowmatcnt[r];
@@ -1441,12 +1462,28 @@ SCIP_RETCODE SCIPmatrixGetParallelCols(
                scale[colidx] = aij;
             assert(scale[colidx] != 0.0);
 
-            colindices[i] = colidx;
-            values[i] = aij / scale[colidx];
             pc = pclass[colidx];
             assert(pc < matrix->ncols);
+            assert(classsizes[pc] > 0);
+
+            /* skip columns that are already alone in their class */
+            if( classsizes[pc] == 1 )
+               continue;
+
+            colindices[i] = colidx;
+            values[i] = aij / scale[colidx];
+            pcs[i] = pc;
 
-            /* update class sizes and pclass set */
+            i++;
+         }
+
+         if( i == 0 )
+            continue;
+
+         /* update class sizes and pclass set */
+         for( k = 0; k < i; ++k )
+         {
+            pc = pcs[k];
             assert(classsizes[pc] > 0);
             classsizes[pc]--;
             if( classsizes[pc] == 0 )
@@ -1454,9 +1491,6 @@ SCIP_RETCODE SCIPmatrixGetParallelCols(
                assert(pcsetfill < matrix->ncols);
                pcset[pcsetfill++] = pc;
             }
-            pcs[i] = pc;
-
-            i++;
          }
 
          /* sort on the pclass values */
@@ -1511,7 +1545,7 @@ SCIP_RETCODE SCIPmatrixGetParallelCols(
                   break;
             }
 
-            if( k == matrix->rowmatcnt[r] )
+            if( k == i )
                break;
          }
       }
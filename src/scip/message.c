@@ -37,6 +37,7 @@
 #include <assert.h>
 
 #include "scip/struct_message.h"
+#include "scip/message.h"
 #include "scip/pub_message.h"
 #include "scip/def.h"
 #include "scip/pub_misc.h"
@@ -310,6 +311,7 @@ SCIP_RETCODE SCIPmessagehdlrCreate(
    (*messagehdlr)->messageinfo = messageinfo;
    (*messagehdlr)->messagehdlrfree = messagehdlrfree;
    (*messagehdlr)->messagehdlrdata = messagehdlrdata;
+   (*messagehdlr)->unflushedfile = NULL;
    (*messagehdlr)->warningbuffer = NULL;
    (*messagehdlr)->dialogbuffer = NULL;
    (*messagehdlr)->infobuffer = NULL;
@@ -407,6 +409,21 @@ void SCIPmessagehdlrSetLogfile(
    messagehdlrOpenLogfile(messagehdlr, filename);
 }
 
+/** sets a file stream that the default message handler does not flush after each message, e.g., a problem file that
+ *  is written by SCIP; all other streams, in particular the terminal and the log file, are still flushed after each
+ *  message
+ */
+void SCIPmessagehdlrSetUnflushedFile(
+   SCIP_MESSAGEHDLR*     messagehdlr,        /**< message handler, or NULL */
+   FILE*                 file                /**< file stream not to flush after each message, or NULL */
+   )
+{
+   assert(file != stdout && file != stderr);
+
+   if( messagehdlr != NULL )
+      messagehdlr->unflushedfile = file;
+}
+
 /** sets the messages handler to be quiet */
 void SCIPmessagehdlrSetQuiet(
    SCIP_MESSAGEHDLR*     messagehdlr,        /**< message handler */
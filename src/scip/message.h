@@ -48,10 +48,24 @@
 #define __SCIP_MESSAGE_H__
 
 
+#include <stdio.h>
+
+#include "scip/def.h"
+#include "scip/type_message.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/** sets a file stream that the default message handler does not flush after each message, e.g., a problem file that
+ *  is written by SCIP; all other streams, in particular the terminal and the log file, are still flushed after each
+ *  message
+ */
+void SCIPmessagehdlrSetUnflushedFile(
+   SCIP_MESSAGEHDLR*     messagehdlr,        /**< message handler, or NULL */
+   FILE*                 file                /**< file stream not to flush after each message, or NULL */
+   );
+
 
 #ifdef __cplusplus
 }
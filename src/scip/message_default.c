@@ -41,13 +41,17 @@
 /** prints a message to the given file stream and writes the same messate to the log file */
 static
 void logMessage(
+   SCIP_MESSAGEHDLR*     messagehdlr,        /**< message handler */
    FILE*                 file,               /**< file stream to print message into */
    const char*           msg                 /**< message to print (or NULL to flush) */
    )
 {
    if ( msg != NULL )
       fputs(msg, file);
-   fflush(file);
+
+   /* a problem file that is currently written is flushed when it is closed */
+   if ( msg == NULL || file != messagehdlr->unflushedfile )
+      fflush(file);
 }
 
 /*
@@ -61,21 +65,21 @@ SCIP_DECL_MESSAGEWARNING(messageWarningDefault)
    if ( msg != NULL && msg[0] != '\0' && msg[0] != '\n' )
       fputs("WARNING: ", file);
 
-   logMessage(file, msg);
+   logMessage(messagehdlr, file, msg);
 }
 
 /** dialog message print method of message handler */
 static
 SCIP_DECL_MESSAGEDIALOG(messageDialogDefault)
 {  /*lint --e{715}*/
-   logMessage(file, msg);
+   logMessage(messagehdlr, file, msg);
 }
 
 /** info message print method of message handler */
 static
 SCIP_DECL_MESSAGEINFO(messageInfoDefault)
 {  /*lint --e{715}*/
-   logMessage(file, msg);
+   logMessage(messagehdlr, file, msg);
 }
 
 /** Create default message handler. To free the message handler use SCIPmessagehdlrRelease(). */
@@ -11001,6 +11001,138 @@ SCIP_Bool SCIPstrToIntValue(
    return FALSE;
 }
 
+/** maximal number of significant decimal digits for which the mantissa is exactly representable as a double */
+#define FASTREAL_MAXDIGITS 15
+
+/** maximal absolute decimal exponent for which the power of ten is exactly representable as a double */
+#define FASTREAL_MAXEXP 22
+
+/** tries to parse a decimal number of the form [+-]digits[.digits][(e|E)[+-]digits] whose mantissa has at most
+ *  FASTREAL_MAXDIGITS significant digits and whose decimal exponent is at most FASTREAL_MAXEXP in absolute value;
+ *  for these numbers, both the mantissa and the power of ten are exact doubles, such that one multiplication or
+ *  division yields the correctly rounded value, i.e., the same value as strtod();
+ *  returns FALSE if the string is not of this form, in which case strtod() needs to be used
+ */
+static
+SCIP_Bool strToRealFast(
+   const char*           str,                /**< string to parse */
+   SCIP_Real*            value,              /**< pointer to store the parsed value */
+   char**                endptr              /**< pointer to store the position after the parsed number */
+   )
+{
+   static const double powersoften[FASTREAL_MAXEXP + 1] = {
+      1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+      1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+   };
+   const char* s;
+   SCIP_Longint mantissa;
+   SCIP_Bool negative;
+   SCIP_Bool hasdigits;
+   int ndigits;
+   int exponent;
+
+   s = str;
+   negative = FALSE;
+   if( *s == '+' || *s == '-' )
+   {
+      negative = (*s == '-');
+      ++s;
+   }
+
+   /* hexadecimal numbers are left to strtod() */
+   if( s[0] == '0' && (s[1] == 'x' || s[1] == 'X') )
+      return FALSE;
+
+   mantissa = 0;
+   ndigits = 0;
+   exponent = 0;
+   hasdigits = FALSE;
+
+   /* integral part; leading zeros do not count as significant digits */
+   while( isdigit((unsigned char)*s) )
+   {
+      if( mantissa > 0 || *s != '0' )
+      {
+         if( ++ndigits > FASTREAL_MAXDIGITS )
+            return FALSE;
+         mantissa = 10 * mantissa + (*s - '0');
+      }
+      hasdigits = TRUE;
+      ++s;
+   }
+
+   /* fractional part */
+   if( *s == '.' )
+   {
+      ++s;
+      while( isdigit((unsigned char)*s) )
+      {
+         if( mantissa > 0 || *s != '0' )
+         {
+            if( ++ndigits > FASTREAL_MAXDIGITS )
+               return FALSE;
+            mantissa = 10 * mantissa + (*s - '0');
+         }
+         --exponent;
+         hasdigits = TRUE;
+         ++s;
+      }
+   }
+
+   if( !hasdigits )
+      return FALSE;
+
+   /* exponent; as in strtod(), it is only part of the number if at least one digit follows */
+   if( *s == 'e' || *s == 'E' )
+   {
+      const char* e;
+      SCIP_Bool negexp;
+      int expval;
+
+      e = s + 1;
+      negexp = FALSE;
+      if( *e == '+' || *e == '-' )
+      {
+         negexp = (*e == '-');
+         ++e;
+      }
+
+      if( isdigit((unsigned char)*e) )
+      {
+         expval = 0;
+         while( isdigit((unsigned char)*e) )
+         {
+            /* larger exponents are left to strtod() */
+            if( expval > 1000 )
+               return FALSE;
+            expval = 10 * expval + (*e - '0');
+            ++e;
+         }
+         exponent += (negexp ? -expval : expval);
+         s = e;
+      }
+   }
+
+   /* a zero mantissa yields zero for every exponent */
+   if( mantissa == 0 )
+      exponent = 0;
+
+   if( exponent < -FASTREAL_MAXEXP || exponent > FASTREAL_MAXEXP )
+      return FALSE;
+
+   if( exponent >= 0 )
+      *value = (double)mantissa * powersoften[exponent];
+   else
+      *value = (double)mantissa / powersoften[-exponent];
+
+   if( negative )
+      *value = -(*value);
+
+   *endptr = (char*)s;
+
+   return TRUE;
+}
+
 /** extract the next token as a double value if it is one; in case no value is parsed the endptr is set to @p str
  *
  *  @return Returns TRUE if a value could be extracted, otherwise FALSE
@@ -11018,6 +11150,13 @@ SCIP_Bool SCIPstrToRealValue(
    /* init errno to detect possible errors */
    errno = 0;
 
+   /* most numbers in problem files are short decimals, which are converted exactly without calling strtod() */
+   if( strToRealFast(str, value, endptr) )
+   {
+      SCIPdebugMessage("parsed real value <%g>\n", *value);
+      return TRUE;
+   }
+
    *value = strtod(str, endptr);
 
    if( *endptr != str && *endptr != NULL )
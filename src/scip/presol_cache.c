@@ -0,0 +1,874 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   presol_cache.c
+ * @ingroup DEFPLUGINS_PRESOL
+ * @brief  presolver that stores the reductions of presolving in a file cache and reapplies them to identical problems
+ *
+ * The fingerprint of a problem is a 64 bit FNV-1a hash of the SCIP version, of the data of the original problem, and of
+ * the values of all parameters except those that cannot influence presolving, like display settings and the time and
+ * memory limits. The problem data consists of the objective sense, offset and scale, the types, bounds, and objective
+ * coefficients of the variables, and the constraint handler, flags, sides, variables, and coefficients of the
+ * constraints; the names do not enter the fingerprint. Numbers enter with their binary representation. Problems with
+ * constraints whose data is not completely given by their variables, coefficients, and sides, e.g., nonlinear
+ * constraints, are not cached.
+ *
+ * A cache file consists of
+ *  - the magic string PRESOLCACHE_MAGIC and the format version,
+ *  - the fingerprint and the number of original variables,
+ *  - the global lower and upper bounds of all original variables in the order of SCIPgetOrigVars(),
+ *  - a flag whether a solution is stored, followed by the values of all original variables in this solution,
+ *  - the fingerprint again, which detects truncated files.
+ *
+ * Numbers are stored in the native binary format, so cache files can only be shared between machines with the same
+ * byte order. A cache file is written to a temporary file first and then renamed, such that concurrent processes never
+ * read a partially written file.
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "blockmemshell/memory.h"
+#include "scip/presol_cache.h"
+#include "scip/pub_cons.h"
+#include "scip/pub_message.h"
+#include "scip/pub_misc.h"
+#include "scip/pub_misc_linear.h"
+#include "scip/pub_paramset.h"
+#include "scip/pub_presol.h"
+#include "scip/pub_var.h"
+#include "scip/scip_benders.h"
+#include "scip/scip_cons.h"
+#include "scip/scip_general.h"
+#include "scip/scip_mem.h"
+#include "scip/scip_message.h"
+#include "scip/scip_numerics.h"
+#include "scip/scip_param.h"
+#include "scip/scip_presol.h"
+#include "scip/scip_pricer.h"
+#include "scip/scip_prob.h"
+#include "scip/scip_sol.h"
+#include "scip/scip_solve.h"
+#include "scip/scip_solvingstats.h"
+#include "scip/scip_var.h"
+#include <stdio.h>
+#include <string.h>
+
+#define PRESOL_NAME            "cache"
+#define PRESOL_DESC            "stores presolving reductions in a file cache and reapplies them to identical problems"
+#define PRESOL_PRIORITY        +9900000 /**< priority of the presolver (>= 0: before, < 0: after constraint handlers) */
+#define PRESOL_MAXROUNDS              1 /**< maximal number of presolving rounds the presolver participates in (-1: no limit) */
+#define PRESOL_TIMING           SCIP_PRESOLTIMING_FAST /* timing of the presolver (fast, medium, or exhaustive) */
+
+#define DEFAULT_DIR                  "" /**< directory of the cache files ("": do not use a cache) */
+
+#define PRESOLCACHE_MAGIC   "SCIPPRESOLCACHE" /**< magic string at the beginning of a cache file */
+#define PRESOLCACHE_VERSION           1 /**< version of the cache file format */
+#define PRESOLCACHE_EXTENSION "presolcache" /**< extension of the cache files */
+
+/** prefixes of the names of parameters that cannot influence presolving and do not enter the fingerprint */
+static const char* fingerprintexcludedparams[] =
+{
+   "display/",
+   "limits/memory",
+   "limits/softtime",
+   "limits/time",
+   "misc/catchctrlc",
+   "presolving/" PRESOL_NAME "/",
+   "timing/",
+   "visual/",
+   "write/"
+};
+
+/** presolver data */
+struct SCIP_PresolData
+{
+   char*                 dir;                /**< directory of the cache files ("": do not use a cache) */
+   uint64_t              fingerprint;        /**< fingerprint of the problem in the current run */
+   SCIP_Bool             hasfingerprint;     /**< was the fingerprint computed in the current run? */
+   SCIP_Bool             loaded;             /**< were the reductions of the current run loaded from the cache? */
+};
+
+
+/*
+ * Local methods
+ */
+
+/** adds a byte sequence to a 64 bit FNV-1a hash value */
+static
+uint64_t hashBytes(
+   uint64_t              hash,               /**< hash value */
+   const void*           bytes,              /**< bytes to add */
+   size_t                nbytes              /**< number of bytes */
+   )
+{
+   const unsigned char* b;
+   size_t i;
+
+   b = (const unsigned char*)bytes;
+
+   for( i = 0; i < nbytes; ++i )
+   {
+      hash ^= (uint64_t)b[i];
+      hash *= UINT64_C(1099511628211);
+   }
+
+   return hash;
+}
+
+/** adds the values of all parameters that can influence presolving to a hash value */
+static
+uint64_t hashParams(
+   SCIP*                 scip,               /**< SCIP data structure */
+   uint64_t              hash                /**< hash value */
+   )
+{
+   SCIP_PARAM** params;
+   int nparams;
+   int p;
+
+   params = SCIPgetParams(scip);
+   nparams = SCIPgetNParams(scip);
+
+   for( p = 0; p < nparams; ++p )
+   {
+      const char* name;
+      SCIP_Bool excluded;
+      int i;
+
+      name = SCIPparamGetName(params[p]);
+
+      excluded = FALSE;
+      for( i = 0; i < (int)(sizeof(fingerprintexcludedparams) / sizeof(fingerprintexcludedparams[0])) && !excluded; ++i )
+         excluded = (strncmp(name, fingerprintexcludedparams[i], strlen(fingerprintexcludedparams[i])) == 0);
+
+      if( excluded )
+         continue;
+
+      hash = hashBytes(hash, name, strlen(name) + 1);
+
+      switch( SCIPparamGetType(params[p]) )
+      {
+      case SCIP_PARAMTYPE_BOOL:
+      {
+         SCIP_Bool value = SCIPparamGetBool(params[p]);
+         hash = hashBytes(hash, &value, sizeof(value));
+         break;
+      }
+      case SCIP_PARAMTYPE_INT:
+      {
+         int value = SCIPparamGetInt(params[p]);
+         hash = hashBytes(hash, &value, sizeof(value));
+         break;
+      }
+      case SCIP_PARAMTYPE_LONGINT:
+      {
+         SCIP_Longint value = SCIPparamGetLongint(params[p]);
+         hash = hashBytes(hash, &value, sizeof(value));
+         break;
+      }
+      case SCIP_PARAMTYPE_REAL:
+      {
+         SCIP_Real value = SCIPparamGetReal(params[p]);
+         hash = hashBytes(hash, &value, sizeof(value));
+         break;
+      }
+      case SCIP_PARAMTYPE_CHAR:
+      {
+         char value = SCIPparamGetChar(params[p]);
+         hash = hashBytes(hash, &value, sizeof(value));
+         break;
+      }
+      case SCIP_PARAMTYPE_STRING:
+      {
+         const char* value = SCIPparamGetString(params[p]);
+         hash = hashBytes(hash, value, strlen(value) + 1);
+         break;
+      }
+      default:
+         SCIPABORT();
+      } /*lint !e788*/
+   }
+
+   return hash;
+}
+
+/** returns whether the data of the given constraint handler is completely described by its variables, coefficients,
+ *  and sides, as returned by SCIPgetConsVars(), SCIPgetConsVals(), SCIPconsGetLhs(), and SCIPconsGetRhs()
+ */
+static
+SCIP_Bool conshdlrIsHashable(
+   const char*           conshdlrname,       /**< name of the constraint handler */
+   SCIP_Bool*            hassides            /**< pointer to store whether the constraints have left- and right-hand sides */
+   )
+{
+   assert(conshdlrname != NULL);
+   assert(hassides != NULL);
+
+   *hassides = (strcmp(conshdlrname, "linear") == 0 || strcmp(conshdlrname, "setppc") == 0
+      || strcmp(conshdlrname, "logicor") == 0 || strcmp(conshdlrname, "knapsack") == 0
+      || strcmp(conshdlrname, "varbound") == 0);
+
+   return *hassides || strcmp(conshdlrname, "SOS1") == 0 || strcmp(conshdlrname, "SOS2") == 0;
+}
+
+/** adds the data of an original constraint to a hash value if the data can be obtained from its constraint handler */
+static
+SCIP_RETCODE hashCons(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONS*            cons,               /**< original constraint */
+   SCIP_VAR***           consvars,           /**< pointer to buffer array for the variables of the constraint */
+   SCIP_Real**           consvals,           /**< pointer to buffer array for the coefficients of the constraint */
+   int*                  consvarssize,       /**< pointer to the size of the buffer arrays */
+   uint64_t*             hash,               /**< pointer to the hash value to update */
+   SCIP_Bool*            success             /**< pointer to store whether the constraint could be hashed */
+   )
+{
+   const char* conshdlrname;
+   SCIP_Bool hassides;
+   SCIP_Bool flags[10];
+   int nconsvars;
+   int v;
+
+   conshdlrname = SCIPconshdlrGetName(SCIPconsGetHdlr(cons));
+
+   *success = conshdlrIsHashable(conshdlrname, &hassides);
+   if( !(*success) )
+   {
+      SCIPverbMessage(scip, SCIP_VERBLEVEL_HIGH, NULL,
+         "problem contains constraints of type <%s> that are not part of the fingerprint; presolving cache is not used\n",
+         conshdlrname);
+      return SCIP_OKAY;
+   }
+
+   SCIP_CALL( SCIPgetConsNVars(scip, cons, &nconsvars, success) );
+   if( !(*success) )
+      return SCIP_OKAY;
+
+   if( nconsvars > *consvarssize )
+   {
+      *consvarssize = SCIPcalcMemGrowSize(scip, nconsvars);
+      SCIP_CALL( SCIPreallocBufferArray(scip, consvars, *consvarssize) );
+      SCIP_CALL( SCIPreallocBufferArray(scip, consvals, *consvarssize) );
+   }
+
+   SCIP_CALL( SCIPgetConsVars(scip, cons, *consvars, *consvarssize, success) );
+   if( !(*success) )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPgetConsVals(scip, cons, *consvals, *consvarssize, success) );
+   if( !(*success) )
+      return SCIP_OKAY;
+
+   *hash = hashBytes(*hash, conshdlrname, strlen(conshdlrname) + 1);
+
+   flags[0] = SCIPconsIsInitial(cons);
+   flags[1] = SCIPconsIsSeparated(cons);
+   flags[2] = SCIPconsIsEnforced(cons);
+   flags[3] = SCIPconsIsChecked(cons);
+   flags[4] = SCIPconsIsPropagated(cons);
+   flags[5] = SCIPconsIsLocal(cons);
+   flags[6] = SCIPconsIsModifiable(cons);
+   flags[7] = SCIPconsIsDynamic(cons);
+   flags[8] = SCIPconsIsRemovable(cons);
+   flags[9] = SCIPconsIsStickingAtNode(cons);
+   *hash = hashBytes(*hash, flags, sizeof(flags));
+
+   if( hassides )
+   {
+      SCIP_Real lhs;
+      SCIP_Real rhs;
+
+      lhs = SCIPconsGetLhs(scip, cons, success);
+      assert(*success);
+      rhs = SCIPconsGetRhs(scip, cons, success);
+      assert(*success);
+
+      *hash = hashBytes(*hash, &lhs, sizeof(lhs));
+      *hash = hashBytes(*hash, &rhs, sizeof(rhs));
+   }
+
+   *hash = hashBytes(*hash, &nconsvars, sizeof(nconsvars));
+
+   /* the variables enter by their position in the original problem, negated variables by the negative position */
+   for( v = 0; v < nconsvars; ++v )
+   {
+      SCIP_VAR* var;
+      int idx;
+
+      var = (*consvars)[v];
+      if( SCIPvarIsNegated(var) )
+         idx = -1 - SCIPvarGetProbindex(SCIPvarGetNegationVar(var));
+      else
+         idx = SCIPvarGetProbindex(var);
+
+      *hash = hashBytes(*hash, &idx, sizeof(idx));
+      *hash = hashBytes(*hash, &(*consvals)[v], sizeof(SCIP_Real));
+   }
+
+   return SCIP_OKAY;
+}
+
+/** computes the fingerprint of the original problem and the parameters
+ *
+ *  The fingerprint is not computed if the problem is empty or contains a constraint whose data is not completely
+ *  described by its variables, coefficients, and sides, since then different problems could have the same fingerprint.
+ */
+static
+SCIP_RETCODE computeFingerprint(
+   SCIP*                 scip,               /**< SCIP data structure */
+   uint64_t*             fingerprint,        /**< pointer to store the fingerprint */
+   SCIP_Bool*            success             /**< pointer to store whether the fingerprint was computed */
+   )
+{
+   SCIP_VAR** vars;
+   SCIP_CONS** conss;
+   SCIP_VAR** consvars;
+   SCIP_Real* consvals;
+   SCIP_OBJSENSE objsense;
+   SCIP_Real version;
+   SCIP_Real value;
+   uint64_t hash;
+   int formatversion;
+   int consvarssize;
+   int nvars;
+   int nconss;
+   int i;
+
+   assert(fingerprint != NULL);
+   assert(success != NULL);
+
+   *success = FALSE;
+
+   vars = SCIPgetOrigVars(scip);
+   nvars = SCIPgetNOrigVars(scip);
+   conss = SCIPgetOrigConss(scip);
+   nconss = SCIPgetNOrigConss(scip);
+
+   /* an empty problem has nothing to cache, and its fingerprint would only depend on the parameters */
+   if( nvars == 0 && nconss == 0 )
+      return SCIP_OKAY;
+
+   hash = UINT64_C(14695981039346656037);
+   version = SCIPversion();
+   hash = hashBytes(hash, &version, sizeof(version));
+   formatversion = PRESOLCACHE_VERSION;
+   hash = hashBytes(hash, &formatversion, sizeof(formatversion));
+
+   /* the numbers enter with their binary representation, such that only bit-identical problems match */
+   objsense = SCIPgetObjsense(scip);
+   hash = hashBytes(hash, &objsense, sizeof(objsense));
+   value = SCIPgetOrigObjoffset(scip);
+   hash = hashBytes(hash, &value, sizeof(value));
+   value = SCIPgetOrigObjscale(scip);
+   hash = hashBytes(hash, &value, sizeof(value));
+   hash = hashBytes(hash, &nvars, sizeof(nvars));
+   hash = hashBytes(hash, &nconss, sizeof(nconss));
+
+   for( i = 0; i < nvars; ++i )
+   {
+      SCIP_VARTYPE vartype;
+
+      assert(SCIPvarGetProbindex(vars[i]) == i);
+
+      vartype = SCIPvarGetType(vars[i]);
+      hash = hashBytes(hash, &vartype, sizeof(vartype));
+      value = SCIPvarGetLbOriginal(vars[i]);
+      hash = hashBytes(hash, &value, sizeof(value));
+      value = SCIPvarGetUbOriginal(vars[i]);
+      hash = hashBytes(hash, &value, sizeof(value));
+      value = SCIPvarGetObj(vars[i]);
+      hash = hashBytes(hash, &value, sizeof(value));
+   }
+
+   consvarssize = SCIPcalcMemGrowSize(scip, MIN(nvars, 64) + 1);
+   SCIP_CALL( SCIPallocBufferArray(scip, &consvars, consvarssize) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &consvals, consvarssize) );
+
+   *success = TRUE;
+   for( i = 0; i < nconss && *success; ++i )
+   {
+      SCIP_CALL( hashCons(scip, conss[i], &consvars, &consvals, &consvarssize, &hash, success) );
+   }
+
+   SCIPfreeBufferArray(scip, &consvals);
+   SCIPfreeBufferArray(scip, &consvars);
+
+   if( !(*success) )
+      return SCIP_OKAY;
+
+   *fingerprint = hashParams(scip, hash);
+
+   return SCIP_OKAY;
+}
+
+/** returns the name of the cache file for the current fingerprint */
+static
+void getCacheFilename(
+   SCIP_PRESOLDATA*      presoldata,         /**< presolver data */
+   char*                 filename            /**< buffer of size SCIP_MAXSTRLEN to store the file name */
+   )
+{
+   assert(presoldata != NULL);
+   assert(presoldata->hasfingerprint);
+
+   (void) SCIPsnprintf(filename, SCIP_MAXSTRLEN, "%s/%016llx." PRESOLCACHE_EXTENSION, presoldata->dir,
+      (unsigned long long)presoldata->fingerprint);
+}
+
+/** reads a cache file; returns whether the file is a valid cache file of the given fingerprint */
+static
+SCIP_Bool readCacheFile(
+   FILE*                 file,               /**< cache file */
+   uint64_t              fingerprint,        /**< expected fingerprint */
+   int                   nvars,              /**< expected number of original variables */
+   SCIP_Real*            lbs,                /**< array to store the lower bounds of the original variables */
+   SCIP_Real*            ubs,                /**< array to store the upper bounds of the original variables */
+   SCIP_Real*            solvals,            /**< array to store the solution values of the original variables */
+   SCIP_Bool*            hassol              /**< pointer to store whether the file contains a solution */
+   )
+{
+   char magic[sizeof(PRESOLCACHE_MAGIC)];
+   uint64_t filefingerprint;
+   int version;
+   int nfilevars;
+   int flag;
+
+   assert(file != NULL);
+   assert(hassol != NULL);
+
+   if( fread(magic, sizeof(magic), 1, file) != 1 || memcmp(magic, PRESOLCACHE_MAGIC, sizeof(magic)) != 0 )
+      return FALSE;
+
+   if( fread(&version, sizeof(version), 1, file) != 1 || version != PRESOLCACHE_VERSION
+      || fread(&filefingerprint, sizeof(filefingerprint), 1, file) != 1 || filefingerprint != fingerprint
+      || fread(&nfilevars, sizeof(nfilevars), 1, file) != 1 || nfilevars != nvars )
+      return FALSE;
+
+   if( fread(lbs, sizeof(SCIP_Real), (size_t)nvars, file) != (size_t)nvars
+      || fread(ubs, sizeof(SCIP_Real), (size_t)nvars, file) != (size_t)nvars )
+      return FALSE;
+
+   if( fread(&flag, sizeof(flag), 1, file) != 1 )
+      return FALSE;
+
+   *hassol = (flag != 0);
+
+   if( *hassol && fread(solvals, sizeof(SCIP_Real), (size_t)nvars, file) != (size_t)nvars )
+      return FALSE;
+
+   /* the fingerprint at the end ensures that the file is complete */
+   if( fread(&filefingerprint, sizeof(filefingerprint), 1, file) != 1 || filefingerprint != fingerprint )
+      return FALSE;
+
+   return TRUE;
+}
+
+/** writes a cache file; returns whether all data could be written */
+static
+SCIP_Bool writeCacheFile(
+   FILE*                 file,               /**< cache file */
+   uint64_t              fingerprint,        /**< fingerprint of the problem */
+   int                   nvars,              /**< number of original variables */
+   SCIP_Real*            lbs,                /**< lower bounds of the original variables */
+   SCIP_Real*            ubs,                /**< upper bounds of the original variables */
+   SCIP_Real*            solvals,            /**< solution values of the original variables, or NULL if no solution */
+   SCIP_Bool             hassol              /**< should the solution values be written? */
+   )
+{
+   int version;
+   int flag;
+
+   assert(file != NULL);
+
+   version = PRESOLCACHE_VERSION;
+   flag = hassol ? 1 : 0;
+
+   return fwrite(PRESOLCACHE_MAGIC, sizeof(PRESOLCACHE_MAGIC), 1, file) == 1
+      && fwrite(&version, sizeof(version), 1, file) == 1
+      && fwrite(&fingerprint, sizeof(fingerprint), 1, file) == 1
+      && fwrite(&nvars, sizeof(nvars), 1, file) == 1
+      && fwrite(lbs, sizeof(SCIP_Real), (size_t)nvars, file) == (size_t)nvars
+      && fwrite(ubs, sizeof(SCIP_Real), (size_t)nvars, file) == (size_t)nvars
+      && fwrite(&flag, sizeof(flag), 1, file) == 1
+      && (!hassol || fwrite(solvals, sizeof(SCIP_Real), (size_t)nvars, file) == (size_t)nvars)
+      && fwrite(&fingerprint, sizeof(fingerprint), 1, file) == 1;
+}
+
+/** adds the stored solution and applies the stored bounds of the cache file of the current fingerprint, if it exists */
+static
+SCIP_RETCODE applyCache(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_PRESOLDATA*      presoldata,         /**< presolver data */
+   int*                  nfixedvars,         /**< pointer to count the number of fixed variables */
+   int*                  nchgbds,            /**< pointer to count the number of changed bounds */
+   SCIP_RESULT*          result              /**< pointer to store the result of the presolver call */
+   )
+{
+   char filename[SCIP_MAXSTRLEN];
+   SCIP_VAR** origvars;
+   SCIP_Real* lbs;
+   SCIP_Real* ubs;
+   SCIP_Real* solvals;
+   SCIP_Bool hassol;
+   SCIP_Bool valid;
+   FILE* file;
+   int norigvars;
+   int nfixed;
+   int nchanged;
+   int v;
+
+   assert(presoldata != NULL);
+   assert(presoldata->hasfingerprint);
+   assert(nfixedvars != NULL);
+   assert(nchgbds != NULL);
+   assert(result != NULL);
+
+   getCacheFilename(presoldata, filename);
+
+   file = fopen(filename, "rb");
+   if( file == NULL )
+   {
+      SCIPdebugMsg(scip, "no presolving cache file <%s>\n", filename);
+      return SCIP_OKAY;
+   }
+
+   origvars = SCIPgetOrigVars(scip);
+   norigvars = SCIPgetNOrigVars(scip);
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &lbs, norigvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &ubs, norigvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &solvals, norigvars) );
+
+   hassol = FALSE;
+   valid = readCacheFile(file, presoldata->fingerprint, norigvars, lbs, ubs, solvals, &hassol);
+   (void) fclose(file);
+
+   if( !valid )
+   {
+      SCIPwarningMessage(scip, "presolving cache file <%s> is invalid and ignored\n", filename);
+      goto TERMINATE;
+   }
+
+   /* the stored bounds may rely on the cutoff bound given by the stored solution */
+   if( hassol )
+   {
+      SCIP_SOL* sol;
+      SCIP_Real solobj;
+      SCIP_Bool stored;
+
+      SCIP_CALL( SCIPcreateOrigSol(scip, &sol, NULL) );
+      SCIP_CALL( SCIPsetSolVals(scip, sol, norigvars, origvars, solvals) );
+      solobj = SCIPgetSolOrigObj(scip, sol);
+
+      SCIP_CALL( SCIPtrySolFree(scip, &sol, FALSE, FALSE, TRUE, TRUE, TRUE, &stored) );
+
+      if( SCIPgetNSols(scip) == 0 || (SCIPgetObjsense(scip) == SCIP_OBJSENSE_MINIMIZE
+            ? SCIPisGT(scip, SCIPgetPrimalbound(scip), solobj) : SCIPisLT(scip, SCIPgetPrimalbound(scip), solobj)) )
+      {
+         SCIPwarningMessage(scip, "solution of presolving cache file <%s> is infeasible; stored reductions are ignored\n",
+            filename);
+         goto TERMINATE;
+      }
+   }
+
+   presoldata->loaded = TRUE;
+   *result = SCIP_DIDNOTFIND;
+   nfixed = 0;
+   nchanged = 0;
+
+   for( v = 0; v < norigvars; ++v )
+   {
+      SCIP_VAR* var;
+      SCIP_Bool infeasible;
+      SCIP_Bool tightened;
+
+      var = SCIPvarGetTransVar(origvars[v]);
+      assert(var != NULL);
+
+      if( SCIPisEQ(scip, lbs[v], ubs[v]) )
+      {
+         SCIP_CALL( SCIPfixVar(scip, var, lbs[v], &infeasible, &tightened) );
+
+         if( tightened )
+            ++nfixed;
+      }
+      else
+      {
+         infeasible = FALSE;
+         tightened = FALSE;
+
+         if( !SCIPisInfinity(scip, -lbs[v]) )
+         {
+            SCIP_CALL( SCIPtightenVarLb(scip, var, lbs[v], FALSE, &infeasible, &tightened) );
+
+            if( tightened )
+               ++nchanged;
+         }
+
+         if( !infeasible && !SCIPisInfinity(scip, ubs[v]) )
+         {
+            SCIP_CALL( SCIPtightenVarUb(scip, var, ubs[v], FALSE, &infeasible, &tightened) );
+
+            if( tightened )
+               ++nchanged;
+         }
+      }
+
+      if( infeasible )
+      {
+         SCIPdebugMsg(scip, "stored bounds [%g,%g] of variable <%s> are infeasible\n", lbs[v], ubs[v],
+            SCIPvarGetName(var));
+         *result = SCIP_CUTOFF;
+         break;
+      }
+   }
+
+   SCIPverbMessage(scip, SCIP_VERBLEVEL_HIGH, NULL, "presolving cache <%s>: %d fixings, %d bound changes\n",
+      filename, nfixed, nchanged);
+
+   *nfixedvars += nfixed;
+   *nchgbds += nchanged;
+
+   if( *result == SCIP_DIDNOTFIND && nfixed + nchanged > 0 )
+      *result = SCIP_SUCCESS;
+
+TERMINATE:
+   SCIPfreeBufferArray(scip, &solvals);
+   SCIPfreeBufferArray(scip, &ubs);
+   SCIPfreeBufferArray(scip, &lbs);
+
+   return SCIP_OKAY;
+}
+
+/** stores the global bounds of the original variables and the best solution in the cache file of the current
+ *  fingerprint
+ */
+static
+SCIP_RETCODE storeCache(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_PRESOLDATA*      presoldata          /**< presolver data */
+   )
+{
+   char filename[SCIP_MAXSTRLEN];
+   char tmpfilename[SCIP_MAXSTRLEN];
+   SCIP_VAR** origvars;
+   SCIP_Real* lbs;
+   SCIP_Real* ubs;
+   SCIP_Real* solvals;
+   SCIP_SOL* sol;
+   SCIP_Bool success;
+   FILE* file;
+   int norigvars;
+   int v;
+
+   assert(presoldata != NULL);
+   assert(presoldata->hasfingerprint);
+
+   getCacheFilename(presoldata, filename);
+   (void) SCIPsnprintf(tmpfilename, SCIP_MAXSTRLEN, "%s.tmp", filename);
+
+   origvars = SCIPgetOrigVars(scip);
+   norigvars = SCIPgetNOrigVars(scip);
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &lbs, norigvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &ubs, norigvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &solvals, norigvars) );
+
+   /* the global bounds of fixed, aggregated, and multi-aggregated variables stay valid */
+   for( v = 0; v < norigvars; ++v )
+   {
+      SCIP_VAR* var;
+
+      var = SCIPvarGetTransVar(origvars[v]);
+      assert(var != NULL);
+
+      lbs[v] = SCIPvarGetLbGlobal(var);
+      ubs[v] = SCIPvarGetUbGlobal(var);
+   }
+
+   sol = SCIPgetBestSol(scip);
+   if( sol != NULL )
+   {
+      SCIP_CALL( SCIPgetSolVals(scip, sol, norigvars, origvars, solvals) );
+   }
+
+   success = FALSE;
+   file = fopen(tmpfilename, "wb");
+   if( file != NULL )
+   {
+      success = writeCacheFile(file, presoldata->fingerprint, norigvars, lbs, ubs, solvals, sol != NULL);
+      success = (fclose(file) == 0) && success;
+
+      /* replace an existing file atomically; on some systems, rename() fails if the target exists */
+      if( success && rename(tmpfilename, filename) != 0 )
+         success = (remove(filename) == 0 && rename(tmpfilename, filename) == 0);
+
+      if( !success )
+         (void) remove(tmpfilename);
+   }
+
+   if( success )
+   {
+      SCIPverbMessage(scip, SCIP_VERBLEVEL_HIGH, NULL, "stored presolving reductions in cache <%s>\n", filename);
+   }
+   else
+   {
+      SCIPwarningMessage(scip, "cannot write presolving cache file <%s>\n", filename);
+   }
+
+   SCIPfreeBufferArray(scip, &solvals);
+   SCIPfreeBufferArray(scip, &ubs);
+   SCIPfreeBufferArray(scip, &lbs);
+
+   return SCIP_OKAY;
+}
+
+
+/*
+ * Callback methods of presolver
+ */
+
+/* the presolver is not copied, since sub-SCIPs must neither read nor write the cache of the main problem */
+
+/** destructor of presolver to free user data (called when SCIP is exiting) */
+static
+SCIP_DECL_PRESOLFREE(presolFreeCache)
+{  /*lint --e{715}*/
+   SCIP_PRESOLDATA* presoldata;
+
+   presoldata = SCIPpresolGetData(presol);
+   assert(presoldata != NULL);
+
+   SCIPfreeBlockMemory(scip, &presoldata);
+   SCIPpresolSetData(presol, NULL);
+
+   return SCIP_OKAY;
+}
+
+/** presolving initialization method of presolver (called when presolving is about to begin) */
+static
+SCIP_DECL_PRESOLINITPRE(presolInitpreCache)
+{  /*lint --e{715}*/
+   SCIP_PRESOLDATA* presoldata;
+
+   presoldata = SCIPpresolGetData(presol);
+   assert(presoldata != NULL);
+
+   presoldata->hasfingerprint = FALSE;
+   presoldata->loaded = FALSE;
+
+   return SCIP_OKAY;
+}
+
+/** presolving deinitialization method of presolver (called after presolving has been finished) */
+static
+SCIP_DECL_PRESOLEXITPRE(presolExitpreCache)
+{  /*lint --e{715}*/
+   SCIP_PRESOLDATA* presoldata;
+
+   presoldata = SCIPpresolGetData(presol);
+   assert(presoldata != NULL);
+
+   /* only store the reductions of a completed presolving of a problem that was not solved yet */
+   if( presoldata->hasfingerprint && !presoldata->loaded && SCIPgetStatus(scip) == SCIP_STATUS_UNKNOWN
+      && !SCIPisStopped(scip) )
+   {
+      SCIP_CALL( storeCache(scip, presoldata) );
+   }
+
+   presoldata->hasfingerprint = FALSE;
+
+   return SCIP_OKAY;
+}
+
+/** presolving execution method */
+static
+SCIP_DECL_PRESOLEXEC(presolExecCache)
+{  /*lint --e{715}*/
+   SCIP_PRESOLDATA* presoldata;
+
+   assert(scip != NULL);
+   assert(presol != NULL);
+   assert(strcmp(SCIPpresolGetName(presol), PRESOL_NAME) == 0);
+   assert(result != NULL);
+
+   *result = SCIP_DIDNOTRUN;
+
+   presoldata = SCIPpresolGetData(presol);
+   assert(presoldata != NULL);
+
+   /* the cache only describes the initial presolving of problems that are completely given by their constraints */
+   if( presoldata->dir[0] == '\0' || SCIPgetNRuns(scip) > 1 || SCIPisReoptEnabled(scip)
+      || SCIPgetNActivePricers(scip) > 0 || SCIPgetNActiveBenders(scip) > 0 )
+      return SCIP_OKAY;
+
+   SCIP_CALL( computeFingerprint(scip, &presoldata->fingerprint, &presoldata->hasfingerprint) );
+
+   if( !presoldata->hasfingerprint )
+      return SCIP_OKAY;
+
+   SCIPdebugMsg(scip, "fingerprint of the problem: %016llx\n", (unsigned long long)presoldata->fingerprint);
+
+   SCIP_CALL( applyCache(scip, presoldata, nfixedvars, nchgbds, result) );
+
+   return SCIP_OKAY;
+}
+
+
+/*
+ * presolver specific interface methods
+ */
+
+/** creates the cache presolver and includes it in SCIP */
+SCIP_RETCODE SCIPincludePresolCache(
+   SCIP*                 scip                /**< SCIP data structure */
+   )
+{
+   SCIP_PRESOLDATA* presoldata;
+   SCIP_PRESOL* presol;
+
+   /* create cache presolver data */
+   SCIP_CALL( SCIPallocBlockMemory(scip, &presoldata) );
+   presoldata->dir = NULL;
+   presoldata->fingerprint = 0;
+   presoldata->hasfingerprint = FALSE;
+   presoldata->loaded = FALSE;
+
+   /* include presolver */
+   SCIP_CALL( SCIPincludePresolBasic(scip, &presol, PRESOL_NAME, PRESOL_DESC, PRESOL_PRIORITY, PRESOL_MAXROUNDS,
+         PRESOL_TIMING, presolExecCache, presoldata) );
+   assert(presol != NULL);
+
+   SCIP_CALL( SCIPsetPresolFree(scip, presol, presolFreeCache) );
+   SCIP_CALL( SCIPsetPresolInitpre(scip, presol, presolInitpreCache) );
+   SCIP_CALL( SCIPsetPresolExitpre(scip, presol, presolExitpreCache) );
+
+   /* add cache presolver parameters */
+   SCIP_CALL( SCIPaddStringParam(scip,
+         "presolving/" PRESOL_NAME "/dir",
+         "directory of the files that store presolving reductions of problems by their fingerprint (\"\": no cache)",
+         &presoldata->dir, FALSE, DEFAULT_DIR, NULL, NULL) );
+
+   return SCIP_OKAY;
+}
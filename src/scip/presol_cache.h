@@ -0,0 +1,71 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   presol_cache.h
+ * @ingroup PRESOLVERS
+ * @brief  presolver that stores the reductions of presolving in a file cache and reapplies them to identical problems
+ *
+ * If the parameter "presolving/cache/dir" is set to a directory, this presolver computes a fingerprint of the
+ * original problem and of the parameter settings when presolving starts. After presolving has been completed, it
+ * stores the global bounds of the transformed counterparts of all original variables and the best solution found so far
+ * in a file in this directory that is named after the fingerprint. If SCIP later presolves a problem with the same
+ * fingerprint, the presolver adds the stored solution and applies the stored bounds and fixings in the first presolving
+ * round, such that the remaining presolvers start from an already reduced problem.
+ *
+ * Aggregations, added or modified constraints, and the postsolve information of other presolvers are not stored, so
+ * presolving still runs on a cache hit, but on a much smaller problem. Since bounds from dual reductions and from the
+ * cutoff bound are only valid together with the solution that was known when they were derived, the stored bounds are
+ * only applied if the stored solution could be added.
+ *
+ * The fingerprint is computed from the data of the problem, so problems are only cached if all their constraints are
+ * linear, set partitioning, packing, or covering, logicor, knapsack, varbound, or SOS constraints.
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#ifndef __SCIP_PRESOL_CACHE_H__
+#define __SCIP_PRESOL_CACHE_H__
+
+#include "scip/def.h"
+#include "scip/type_retcode.h"
+#include "scip/type_scip.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** creates the cache presolver and includes it in SCIP
+ *
+ * @ingroup PresolverIncludes
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPincludePresolCache(
+   SCIP*                 scip                /**< SCIP data structure */
+   );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
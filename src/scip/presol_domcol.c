@@ -51,6 +51,7 @@
 #include "scip/presol_domcol.h"
 #include "scip/pub_matrix.h"
 #include "scip/pub_message.h"
+#include "scip/pub_misc.h"
 #include "scip/pub_misc_sort.h"
 #include "scip/pub_presol.h"
 #include "scip/pub_var.h"
@@ -76,6 +77,10 @@
 #define DEFAULT_NUMMINPAIRS         1024     /**< minimal number of pair comparisons */
 #define DEFAULT_NUMMAXPAIRS      1048576     /**< maximal number of pair comparisons */
 
+#define DEFAULT_MAXWORKFAC        1000.0     /**< maximal work of a call, i.e., the number of compared column pairs plus the
+                                              *   number of nonzeros visited in pair comparisons, relative to the number
+                                              *   of nonzeros of the matrix (-1: no limit) */
+
 #define DEFAULT_PREDBNDSTR         FALSE     /**< should predictive bound strengthening be applied? */
 #define DEFAULT_CONTINUOUS_RED      TRUE     /**< should reductions for continuous variables be carried out? */
 
@@ -91,6 +96,11 @@ struct SCIP_PresolData
    int                   numminpairs;        /**< minimal number of pair comparisons */
    int                   nummaxpairs;        /**< maximal number of pair comparisons */
    int                   numcurrentpairs;    /**< current number of pair comparisons */
+   SCIP_Real             maxworkfac;         /**< maximal work of a call relative to the number of nonzeros (-1: no limit) */
+   SCIP_Longint          maxwork;            /**< maximal work of the current call (-1: no limit) */
+   SCIP_Longint          work;               /**< work spent in the current call */
+   SCIP_Longint          npairs;             /**< number of column pairs compared in the current call */
+   SCIP_Longint          nsigpairs;          /**< number of column pairs excluded by signatures in the current call */
    SCIP_Bool             predbndstr;         /**< flag indicating if predictive bound strengthening should be applied */
    SCIP_Bool             continuousred;      /**< flag indicating if reductions for continuous variables should be performed */
 };
@@ -1030,179 +1040,6 @@ SCIP_RETCODE updateBounds(
    return SCIP_OKAY;
 }
 
-/** detect parallel columns by using the algorithm of Bixby and Wagner
- *  see paper: "A note on Detecting Simple Redundancies in Linear Systems", June 1986
- */
-static
-SCIP_RETCODE detectParallelCols(
-   SCIP*                 scip,               /**< SCIP main data structure */
-   SCIP_MATRIX*          matrix,             /**< matrix containing the constraints */
-   int*                  pclass,             /**< parallel column classes */
-   SCIP_Bool*            varineq             /**< indicating if variable is within an equation */
-   )
-{
-   SCIP_Real* valpnt;
-   SCIP_Real* values;
-   SCIP_Real* scale;
-   int* classsizes;
-   int* pcset;
-   int* rowpnt;
-   int* rowend;
-   int* colindices;
-   int* pcs;
-   SCIP_Real startval;
-   SCIP_Real aij;
-   int startpc;
-   int startk;
-   int startt;
-   int pcsetfill;
-   int colidx;
-   int k;
-   int t;
-   int m;
-   int i;
-   int r;
-   int newpclass;
-   int pc;
-   int nrows;
-   int ncols;
-
-   assert(scip != NULL);
-   assert(matrix != NULL);
-   assert(pclass != NULL);
-   assert(varineq != NULL);
-
-   nrows = SCIPmatrixGetNRows(matrix);
-   ncols = SCIPmatrixGetNColumns(matrix);
-
-   SCIP_CALL( SCIPallocBufferArray(scip, &classsizes, ncols) );
-   SCIP_CALL( SCIPallocBufferArray(scip, &scale, ncols) );
-   SCIP_CALL( SCIPallocBufferArray(scip, &pcset, ncols) );
-   SCIP_CALL( SCIPallocBufferArray(scip, &values, ncols) );
-   SCIP_CALL( SCIPallocBufferArray(scip, &colindices, ncols) );
-   SCIP_CALL( SCIPallocBufferArray(scip, &pcs, ncols) );
-
-   BMSclearMemoryArray(scale, ncols);
-   BMSclearMemoryArray(pclass, ncols);
-   BMSclearMemoryArray(classsizes, ncols);
-
-   classsizes[0] = ncols;
-   pcsetfill = 0;
-   for( t = 1; t < ncols; ++t )
-      pcset[pcsetfill++] = t;
-
-   /* loop over all rows */
-   for( r = 0; r < nrows; ++r )
-   {
-      /* we consider only non-empty equations or ranged rows */
-      if( !SCIPmatrixIsRowRhsInfinity(matrix, r) && SCIPmatrixGetRowNNonzs(matrix, r) > 0 )
-      {
-         rowpnt = SCIPmatrixGetRowIdxPtr(matrix, r);
-         rowend = rowpnt + SCIPmatrixGetRowNNonzs(matrix, r);
-         valpnt = SCIPmatrixGetRowValPtr(matrix, r);
-
-         i = 0;
-         for( ; (rowpnt < rowend); rowpnt++, valpnt++ )
-         {
-            aij = *valpnt;
-            colidx = *rowpnt;
-
-            /* remember variable was part of an equation or ranged row */
-            varineq[colidx] = TRUE;
-
-            if( scale[colidx] == 0.0 )
-               scale[colidx] = aij;
-            assert(scale[colidx] != 0.0);
-
-            colindices[i] = colidx;
-            values[i] = aij / scale[colidx];
-            pc = pclass[colidx];
-            assert(pc < ncols);
-
-            /* update class sizes and pclass set */
-            assert(classsizes[pc] > 0);
-            classsizes[pc]--;
-            if( classsizes[pc] == 0 )
-            {
-               assert(pcsetfill < ncols);
-               pcset[pcsetfill++] = pc;
-            }
-            pcs[i] = pc;
-
-            i++;
-         }
-
-         assert(i > 0);
-
-         /* sort on the pclass values */
-         if( i > 1 )
-         {
-            SCIPsortIntIntReal(pcs, colindices, values, i);
-         }
-
-         k = 0;
-         while( TRUE ) /*lint !e716*/
-         {
-            assert(k < i);
-            startpc = pcs[k];
-            startk = k;
-
-            /* find pclass-sets */
-            while( k < i && pcs[k] == startpc )
-               k++;
-
-            /* sort on the A values which have equal pclass values */
-            if( k - startk > 1 )
-               SCIPsortRealInt(&(values[startk]), &(colindices[startk]), k - startk);
-
-            t = 0;
-            while( TRUE ) /*lint !e716*/
-            {
-               assert(startk + t < i);
-               startval = values[startk + t];
-               startt = t;
-
-               /* find A-sets */
-               while( t < k - startk && SCIPisEQ(scip, startval, values[startk + t]) )
-                  t++;
-
-               /* get new pclass */
-               newpclass = pcset[0];
-               assert(pcsetfill > 0);
-               pcset[0] = pcset[--pcsetfill];
-
-               /* renumbering */
-               for( m = startk + startt; m < startk + t; m++ )
-               {
-                  assert(m < i);
-                  assert(colindices[m] < ncols);
-                  assert(newpclass < ncols);
-
-                  pclass[colindices[m]] = newpclass;
-                  classsizes[newpclass]++;
-               }
-
-               if( t == k - startk )
-                  break;
-            }
-
-            if( k == SCIPmatrixGetRowNNonzs(matrix, r) )
-               break;
-         }
-      }
-   }
-
-   SCIPfreeBufferArray(scip, &pcs);
-   SCIPfreeBufferArray(scip, &colindices);
-   SCIPfreeBufferArray(scip, &values);
-   SCIPfreeBufferArray(scip, &pcset);
-   SCIPfreeBufferArray(scip, &scale);
-   SCIPfreeBufferArray(scip, &classsizes);
-
-   return SCIP_OKAY;
-}
-
-
 /** try to improve variable bounds by predictive bound strengthening */
 static
 SCIP_RETCODE predBndStr(
@@ -1539,12 +1376,81 @@ SCIP_RETCODE findFixings(
    return SCIP_OKAY;
 }
 
+/** computes bit signatures of the rows of each column
+ *
+ *  A column can only dominate another column if it has a positive coefficient in every inequality in which the other
+ *  column has a positive coefficient, if the other column has a negative coefficient in every inequality in which it
+ *  has a negative coefficient, and if both columns appear in the same equations and ranged rows. Since these are
+ *  subset relations, they can be checked on bit signatures of the corresponding row sets before merging the columns.
+ */
+static
+void computeColSignatures(
+   SCIP_MATRIX*          matrix,             /**< matrix containing the constraints */
+   uint64_t*             possigs,            /**< array to store signatures of inequalities with positive coefficient */
+   uint64_t*             negsigs,            /**< array to store signatures of inequalities with negative coefficient */
+   uint64_t*             eqsigs              /**< array to store signatures of equations and ranged rows */
+   )
+{
+   int ncols;
+   int c;
+
+   assert(matrix != NULL);
+   assert(possigs != NULL);
+   assert(negsigs != NULL);
+   assert(eqsigs != NULL);
+
+   ncols = SCIPmatrixGetNColumns(matrix);
+
+   for( c = 0; c < ncols; ++c )
+   {
+      SCIP_Real* valpnt;
+      int* colpnt;
+      int* colend;
+
+      possigs[c] = 0;
+      negsigs[c] = 0;
+      eqsigs[c] = 0;
+
+      colpnt = SCIPmatrixGetColIdxPtr(matrix, c);
+      colend = colpnt + SCIPmatrixGetColNNonzs(matrix, c);
+      valpnt = SCIPmatrixGetColValPtr(matrix, c);
+
+      for( ; colpnt < colend; colpnt++, valpnt++ )
+      {
+         if( !SCIPmatrixIsRowRhsInfinity(matrix, *colpnt) )
+            eqsigs[c] |= SCIPhashSignature64(*colpnt);
+         else if( *valpnt > 0.0 )
+            possigs[c] |= SCIPhashSignature64(*colpnt);
+         else
+            negsigs[c] |= SCIPhashSignature64(*colpnt);
+      }
+   }
+}
+
+/** checks whether the signatures of two columns allow the first column to dominate the second one */
+static
+SCIP_Bool signaturesAllowDominance(
+   uint64_t*             possigs,            /**< signatures of inequalities with positive coefficient */
+   uint64_t*             negsigs,            /**< signatures of inequalities with negative coefficient */
+   uint64_t*             eqsigs,             /**< signatures of equations and ranged rows */
+   int                   dominatingcol,      /**< index of the dominating column */
+   int                   dominatedcol        /**< index of the dominated column */
+   )
+{
+   return (possigs[dominatedcol] & ~possigs[dominatingcol]) == 0
+      && (negsigs[dominatingcol] & ~negsigs[dominatedcol]) == 0
+      && eqsigs[dominatingcol] == eqsigs[dominatedcol];
+}
+
 /** find dominance relation between variable pairs */
 static
 SCIP_RETCODE findDominancePairs(
    SCIP*                 scip,               /**< SCIP main data structure */
    SCIP_MATRIX*          matrix,             /**< matrix containing the constraints */
    SCIP_PRESOLDATA*      presoldata,         /**< presolver data */
+   uint64_t*             possigs,            /**< signatures of inequalities with positive coefficient of each column */
+   uint64_t*             negsigs,            /**< signatures of inequalities with negative coefficient of each column */
+   uint64_t*             eqsigs,             /**< signatures of equations and ranged rows of each column */
    int*                  searchcols,         /**< indexes of variables for pair comparisons */
    int                   searchsize,         /**< number of variables for pair comparisons */
    SCIP_Bool             onlybinvars,        /**< flag indicating searchcols contains only binary variable indexes */
@@ -1670,8 +1576,24 @@ SCIP_RETCODE findDominancePairs(
          }
          paircnt++;
 
+         /* stop if the work limit is reached */
+         if( presoldata->maxwork >= 0 && presoldata->work >= presoldata->maxwork )
+            return SCIP_OKAY;
+         presoldata->work++;
+         presoldata->npairs++;
+
+         if( !col1domcol2 && !col2domcol1 )
+            continue;
+
+         /* exclude dominance relations that are impossible by the row sets of the columns */
+         col1domcol2 = col1domcol2 && signaturesAllowDominance(possigs, negsigs, eqsigs, col1, col2);
+         col2domcol1 = col2domcol1 && signaturesAllowDominance(possigs, negsigs, eqsigs, col2, col1);
+
          if( !col1domcol2 && !col2domcol1 )
+         {
+            presoldata->nsigpairs++;
             continue;
+         }
 
          /* get the data for both columns */
          vals1 = SCIPmatrixGetColValPtr(matrix, col1);
@@ -1874,6 +1796,8 @@ SCIP_RETCODE findDominancePairs(
             }
          }
 
+         presoldata->work += r1 + r2;
+
          /* a column is only dominated, if there are no more rows in which it is contained */
          col1domcol2 = col1domcol2 && r2 == nrows2;
          col2domcol1 = col2domcol1 && r1 == nrows1;
@@ -2034,6 +1958,10 @@ SCIP_DECL_PRESOLEXEC(presolExecDomcol)
    int nintvarsfixed = 0;
    int nbinvarsfixed = 0;
 #endif
+   SCIP_Real* scale;
+   uint64_t* possigs;
+   uint64_t* negsigs;
+   uint64_t* eqsigs;
    int* pclass;
    int* colidx;
    int pclassstart;
@@ -2108,9 +2036,24 @@ SCIP_DECL_PRESOLEXEC(presolExecDomcol)
       varineq[v] = FALSE;
    }
 
+   SCIP_CALL( SCIPallocBufferArray(scip, &possigs, ncols) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &negsigs, ncols) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &eqsigs, ncols) );
+   computeColSignatures(matrix, possigs, negsigs, eqsigs);
+
    /* init pair comparision control */
    presoldata->numcurrentpairs = presoldata->nummaxpairs;
 
+   /* init work limit */
+   presoldata->work = 0;
+   presoldata->npairs = 0;
+   presoldata->nsigpairs = 0;
+   if( presoldata->maxworkfac >= 0.0 )
+      presoldata->maxwork = (SCIP_Longint)MIN(presoldata->maxworkfac * MAX(SCIPmatrixGetNNonzs(matrix), ncols),
+         (SCIP_Real)SCIP_LONGINT_MAX);
+   else
+      presoldata->maxwork = -1;
+
    varcount = 0;
 
    /* 1.stage: search dominance relations of parallel columns
@@ -2118,7 +2061,10 @@ SCIP_DECL_PRESOLEXEC(presolExecDomcol)
       */
    if( (presoltiming & SCIP_PRESOLTIMING_EXHAUSTIVE) != 0 )
    {
-      SCIP_CALL( detectParallelCols(scip, matrix, pclass, varineq) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &scale, ncols) );
+      SCIP_CALL( SCIPmatrixGetParallelCols(scip, matrix, scale, pclass, varineq) );
+      SCIPfreeBufferArray(scip, &scale);
+
       SCIPsortIntInt(pclass, colidx, ncols);
 
       pc = 0;
@@ -2165,7 +2111,7 @@ SCIP_DECL_PRESOLEXEC(presolExecDomcol)
          /* continuous variables */
          if( nconfill > 1 && presoldata->continuousred )
          {
-            SCIP_CALL( findDominancePairs(scip, matrix, presoldata, consearchcols, nconfill, FALSE,
+            SCIP_CALL( findDominancePairs(scip, matrix, presoldata, possigs, negsigs, eqsigs, consearchcols, nconfill, FALSE,
                   varstofix, &nfixings, &ndomrelations, nchgbds) );
 
             for( v = 0; v < nconfill; ++v )
@@ -2182,7 +2128,7 @@ SCIP_DECL_PRESOLEXEC(presolExecDomcol)
          /* integer and impl-integer variables */
          if( nintfill > 1 )
          {
-            SCIP_CALL( findDominancePairs(scip, matrix, presoldata, intsearchcols, nintfill, FALSE,
+            SCIP_CALL( findDominancePairs(scip, matrix, presoldata, possigs, negsigs, eqsigs, intsearchcols, nintfill, FALSE,
                   varstofix, &nfixings, &ndomrelations, nchgbds) );
 
             for( v = 0; v < nintfill; ++v )
@@ -2199,7 +2145,7 @@ SCIP_DECL_PRESOLEXEC(presolExecDomcol)
          /* binary variables */
          if( nbinfill > 1 )
          {
-            SCIP_CALL( findDominancePairs(scip, matrix, presoldata, binsearchcols, nbinfill, TRUE,
+            SCIP_CALL( findDominancePairs(scip, matrix, presoldata, possigs, negsigs, eqsigs, binsearchcols, nbinfill, TRUE,
                   varstofix, &nfixings, &ndomrelations, nchgbds) );
 
             for( v = 0; v < nbinfill; ++v )
@@ -2237,6 +2183,10 @@ SCIP_DECL_PRESOLEXEC(presolExecDomcol)
          if( (r % 1000 == 0) && SCIPisStopped(scip) )
             break;
 
+         /* break if the work limit was reached */
+         if( presoldata->maxwork >= 0 && presoldata->work >= presoldata->maxwork )
+            break;
+
          rowidx = rowidxsorted[r];
          rowpnt = SCIPmatrixGetRowIdxPtr(matrix, rowidx);
          rowend = rowpnt + SCIPmatrixGetRowNNonzs(matrix, rowidx);
@@ -2278,7 +2228,7 @@ SCIP_DECL_PRESOLEXEC(presolExecDomcol)
          /* continuous variables */
          if( nconfill > 1 && presoldata->continuousred )
          {
-            SCIP_CALL( findDominancePairs(scip, matrix, presoldata, consearchcols, nconfill, FALSE,
+            SCIP_CALL( findDominancePairs(scip, matrix, presoldata, possigs, negsigs, eqsigs, consearchcols, nconfill, FALSE,
                   varstofix, &nfixings, &ndomrelations, nchgbds) );
 
             for( v = 0; v < nconfill; ++v )
@@ -2290,7 +2240,7 @@ SCIP_DECL_PRESOLEXEC(presolExecDomcol)
          /* integer and impl-integer variables */
          if( nintfill > 1 )
          {
-            SCIP_CALL( findDominancePairs(scip, matrix, presoldata, intsearchcols, nintfill, FALSE,
+            SCIP_CALL( findDominancePairs(scip, matrix, presoldata, possigs, negsigs, eqsigs, intsearchcols, nintfill, FALSE,
                   varstofix, &nfixings, &ndomrelations, nchgbds) );
 
             for( v = 0; v < nintfill; ++v )
@@ -2302,7 +2252,7 @@ SCIP_DECL_PRESOLEXEC(presolExecDomcol)
          /* binary variables */
          if( nbinfill > 1 )
          {
-            SCIP_CALL( findDominancePairs(scip, matrix, presoldata, binsearchcols, nbinfill, TRUE,
+            SCIP_CALL( findDominancePairs(scip, matrix, presoldata, possigs, negsigs, eqsigs, binsearchcols, nbinfill, TRUE,
                   varstofix, &nfixings, &ndomrelations, nchgbds) );
 
             for( v = 0; v < nbinfill; ++v )
@@ -2396,6 +2346,13 @@ SCIP_DECL_PRESOLEXEC(presolExecDomcol)
          *result = SCIP_SUCCESS;
    }
 
+   SCIPstatisticMessage("domcol: %" SCIP_LONGINT_FORMAT " pairs compared, %" SCIP_LONGINT_FORMAT " excluded by signatures, "
+      "work %" SCIP_LONGINT_FORMAT " of %" SCIP_LONGINT_FORMAT ", %d fixings\n", presoldata->npairs, presoldata->nsigpairs,
+      presoldata->work, presoldata->maxwork, nfixings);
+
+   SCIPfreeBufferArray(scip, &eqsigs);
+   SCIPfreeBufferArray(scip, &negsigs);
+   SCIPfreeBufferArray(scip, &possigs);
    SCIPfreeBufferArray(scip, &varineq);
    SCIPfreeBufferArray(scip, &colidx);
    SCIPfreeBufferArray(scip, &pclass);
@@ -2451,6 +2408,11 @@ SCIP_RETCODE SCIPincludePresolDomcol(
          "maximal number of pair comparisons",
          &presoldata->nummaxpairs, FALSE, DEFAULT_NUMMAXPAIRS, DEFAULT_NUMMINPAIRS, 1000000000, NULL, NULL) );
 
+   SCIP_CALL( SCIPaddRealParam(scip,
+         "presolving/domcol/maxworkfac",
+         "maximal work of a call, i.e., the number of compared column pairs plus the number of visited nonzeros, relative to the number of nonzeros (-1: no limit)",
+         &presoldata->maxworkfac, TRUE, DEFAULT_MAXWORKFAC, -1.0, SCIP_REAL_MAX, NULL, NULL) );
+
    SCIP_CALL( SCIPaddBoolParam(scip,
          "presolving/domcol/predbndstr",
          "should predictive bound strengthening be applied?",
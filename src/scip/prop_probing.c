@@ -34,6 +34,7 @@
 
 #include "blockmemshell/memory.h"
 #include "scip/prop_probing.h"
+#include "scip/pub_matrix.h"
 #include "scip/pub_message.h"
 #include "scip/pub_misc.h"
 #include "scip/pub_misc_sort.h"
@@ -41,6 +42,8 @@
 #include "scip/pub_tree.h"
 #include "scip/pub_var.h"
 #include "scip/scip_branch.h"
+#include "scip/scip_concurrent.h"
+#include "scip/scip_copy.h"
 #include "scip/scip_general.h"
 #include "scip/scip_lp.h"
 #include "scip/scip_mem.h"
@@ -55,6 +58,9 @@
 #include "scip/scip_timing.h"
 #include "scip/scip_tree.h"
 #include "scip/scip_var.h"
+#include "scip/syncstore.h"
+#include "tpi/tpi.h"
+#include "tpi/def_openmp.h"
 #include <string.h>
 
 #define PROP_NAME               "probing"
@@ -93,6 +99,9 @@
                                          *   (0: don't abort) */
 #define DEFAULT_MAXDEPTH            -1  /**< maximal depth until propagation is executed(-1: no limit) */
 #define DEFAULT_RANDSEED            59  /**< random initial seed */
+#define DEFAULT_NTHREADS             1  /**< number of threads used to probe in parallel during presolving (1: sequential) */
+
+#define PROBING_NVARSPERJOB         16  /**< number of variables probed by each thread in a round of parallel probing */
 
 /*
  * Data structures
@@ -128,7 +137,41 @@ struct SCIP_PropData
    int                   maxdepth;           /**< maximal depth until propagation is executed */
    SCIP_Longint          lastnode;           /**< last node where probing was applied, or -1 for presolving, and -2 for not applied yet */
    SCIP_RANDNUMGEN*      randnumgen;         /**< random number generator */
+   int                   nthreads;           /**< number of threads used to probe in parallel during presolving
+                                              *   (1: sequential) */
+   int                   nparallelcalls;     /**< number of presolving calls that probed in parallel */
+};
+
+/** job of the parallel probing mode: probes a batch of binary variables on a private copy of the global domains and
+ *  propagates only the rows of the constraint matrix, such that no SCIP data is modified
+ */
+struct ProbingJob
+{
+   SCIP*                 scip;               /**< SCIP data structure (only used for numerical comparisons) */
+   SCIP_MATRIX*          matrix;             /**< constraint matrix */
+   SCIP_Real*            baselbs;            /**< lower bounds of the columns at the start of the round (shared) */
+   SCIP_Real*            baseubs;            /**< upper bounds of the columns at the start of the round (shared) */
+   SCIP_Bool*            isintegral;         /**< is the variable of the column integral? (shared) */
+   SCIP_Real*            lbs;                /**< private lower bounds of the columns */
+   SCIP_Real*            ubs;                /**< private upper bounds of the columns */
+   SCIP_Bool*            colchanged;         /**< was the bound of the column changed in the current probe? */
+   int*                  changedcols;        /**< columns with changed bounds in the current probe */
+   SCIP_Bool*            rowinqueue;         /**< is the row in the propagation queue? */
+   int*                  rowqueue;           /**< cyclic propagation queue of rows */
+   int*                  probecols;          /**< columns to probe on in the current round */
+   int*                  probeidxs;          /**< positions of the probed variables in the sorted variables array */
+   int*                  resbegs;            /**< start of the bound changes of probe 2k (to zero) and 2k+1 (to one) of the
+                                              *   k-th probed column in the result arrays */
+   SCIP_Bool*            rescutoffs;         /**< was probe 2k (to zero) or 2k+1 (to one) infeasible? */
+   int*                  rescols;            /**< columns of the bound changes found */
+   SCIP_Real*            reslbs;             /**< new lower bounds of the columns */
+   SCIP_Real*            resubs;             /**< new upper bounds of the columns */
+   int                   nres;               /**< number of bound changes found in the current round */
+   int                   ressize;            /**< size of the result arrays */
+   int                   nprobecols;         /**< number of columns to probe on in the current round */
+   int                   maxproprounds;      /**< maximal number of propagation rounds in each probe (-1: no limit) */
 };
+typedef struct ProbingJob PROBINGJOB;
 
 
 /*
@@ -156,6 +199,7 @@ SCIP_RETCODE initPropdata(
    propdata->nuseless = 0;
    propdata->ntotaluseless = 0;
    propdata->nsumuseless = 0;
+   propdata->nparallelcalls = 0;
    propdata->lastnode = -2;
    propdata->randnumgen = NULL;
 
@@ -725,6 +769,743 @@ SCIP_RETCODE applyProbing(
 }
 
 
+/** tightens a bound of a column in the private domains of a parallel probing job and adds the rows of the column to the
+ *  propagation queue
+ */
+static
+void tightenColBoundJob(
+   PROBINGJOB*           job,                /**< parallel probing job */
+   int                   col,                /**< column to tighten */
+   SCIP_BOUNDTYPE        boundtype,          /**< type of the bound to tighten */
+   SCIP_Real             newbound,           /**< new bound */
+   int*                  nchanged,           /**< pointer to update the number of columns with changed bounds */
+   int*                  queueend,           /**< pointer to update the end of the propagation queue */
+   int*                  nqueued,            /**< pointer to update the number of rows in the propagation queue */
+   SCIP_Bool*            infeasible          /**< pointer to store whether the new bound is infeasible */
+   )
+{
+   SCIP* scip;
+   int* colrows;
+   int ncolrows;
+   int nrows;
+   int k;
+
+   scip = job->scip;
+
+   if( boundtype == SCIP_BOUNDTYPE_LOWER )
+   {
+      if( job->isintegral[col] )
+         newbound = SCIPfeasCeil(scip, newbound);
+
+      if( SCIPisFeasGT(scip, newbound, job->ubs[col]) )
+      {
+         *infeasible = TRUE;
+         return;
+      }
+
+      if( job->isintegral[col] ? newbound <= job->lbs[col] + 0.5 : !SCIPisLbBetter(scip, newbound, job->lbs[col], job->ubs[col]) )
+         return;
+
+      job->lbs[col] = MIN(newbound, job->ubs[col]);
+   }
+   else
+   {
+      if( job->isintegral[col] )
+         newbound = SCIPfeasFloor(scip, newbound);
+
+      if( SCIPisFeasLT(scip, newbound, job->lbs[col]) )
+      {
+         *infeasible = TRUE;
+         return;
+      }
+
+      if( job->isintegral[col] ? newbound >= job->ubs[col] - 0.5 : !SCIPisUbBetter(scip, newbound, job->lbs[col], job->ubs[col]) )
+         return;
+
+      job->ubs[col] = MAX(newbound, job->lbs[col]);
+   }
+
+   if( !job->colchanged[col] )
+   {
+      job->colchanged[col] = TRUE;
+      job->changedcols[(*nchanged)++] = col;
+   }
+
+   /* the rows of the column have to be propagated again */
+   colrows = SCIPmatrixGetColIdxPtr(job->matrix, col);
+   ncolrows = SCIPmatrixGetColNNonzs(job->matrix, col);
+   nrows = SCIPmatrixGetNRows(job->matrix);
+
+   for( k = 0; k < ncolrows; ++k )
+   {
+      if( !job->rowinqueue[colrows[k]] )
+      {
+         job->rowinqueue[colrows[k]] = TRUE;
+         job->rowqueue[*queueend] = colrows[k];
+         *queueend = (*queueend + 1) % nrows;
+         ++(*nqueued);
+      }
+   }
+}
+
+/** returns whether the activity contribution of a matrix entry at the given bound is infinite or so large that the
+ *  activity bounds it enters are not reliable
+ */
+static
+SCIP_Bool isContributionInfinite(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_Real             val,                /**< coefficient of the entry */
+   SCIP_Real             bound               /**< bound of the column */
+   )
+{
+   return SCIPisInfinity(scip, REALABS(bound)) || SCIPisHugeValue(scip, REALABS(val * bound));
+}
+
+/** propagates a row of the constraint matrix on the private domains of a parallel probing job by its minimal and
+ *  maximal activity
+ *
+ *  As in cons_linear, infinite and huge contributions are counted separately, huge activities are not used, and a bound
+ *  is only tightened by the slack of the row if the slack is smaller than the contribution range of the column by more
+ *  than the summation epsilon.
+ */
+static
+void propagateRowJob(
+   PROBINGJOB*           job,                /**< parallel probing job */
+   int                   row,                /**< row to propagate */
+   int*                  nchanged,           /**< pointer to update the number of columns with changed bounds */
+   int*                  queueend,           /**< pointer to update the end of the propagation queue */
+   int*                  nqueued,            /**< pointer to update the number of rows in the propagation queue */
+   SCIP_Bool*            infeasible          /**< pointer to store whether the row is infeasible */
+   )
+{
+   SCIP* scip;
+   SCIP_Real* rowvals;
+   int* rowcols;
+   SCIP_Real minact;
+   SCIP_Real maxact;
+   SCIP_Real lhs;
+   SCIP_Real rhs;
+   SCIP_Bool lhsinf;
+   SCIP_Bool rhsinf;
+   int nmininf;
+   int nmaxinf;
+   int nrowcols;
+   int k;
+
+   scip = job->scip;
+   rowvals = SCIPmatrixGetRowValPtr(job->matrix, row);
+   rowcols = SCIPmatrixGetRowIdxPtr(job->matrix, row);
+   nrowcols = SCIPmatrixGetRowNNonzs(job->matrix, row);
+   lhs = SCIPmatrixGetRowLhs(job->matrix, row);
+   rhs = SCIPmatrixGetRowRhs(job->matrix, row);
+   lhsinf = SCIPisInfinity(scip, -lhs);
+   rhsinf = SCIPmatrixIsRowRhsInfinity(job->matrix, row);
+
+   /* compute the activity bounds of the row; infinite and huge contributions are counted separately */
+   minact = 0.0;
+   maxact = 0.0;
+   nmininf = 0;
+   nmaxinf = 0;
+   for( k = 0; k < nrowcols; ++k )
+   {
+      SCIP_Real val = rowvals[k];
+      SCIP_Real minbound = (val > 0.0) ? job->lbs[rowcols[k]] : job->ubs[rowcols[k]];
+      SCIP_Real maxbound = (val > 0.0) ? job->ubs[rowcols[k]] : job->lbs[rowcols[k]];
+
+      if( isContributionInfinite(scip, val, minbound) )
+         ++nmininf;
+      else
+         minact += val * minbound;
+
+      if( isContributionInfinite(scip, val, maxbound) )
+         ++nmaxinf;
+      else
+         maxact += val * maxbound;
+   }
+
+   /* activities that are huge in absolute value suffer from cancellation and are not used */
+   if( SCIPisHugeValue(scip, REALABS(minact)) )
+      nmininf = nrowcols + 1;
+   if( SCIPisHugeValue(scip, REALABS(maxact)) )
+      nmaxinf = nrowcols + 1;
+
+   if( (!rhsinf && nmininf == 0 && SCIPisFeasLT(scip, rhs, minact))
+      || (!lhsinf && nmaxinf == 0 && SCIPisFeasGT(scip, lhs, maxact)) )
+   {
+      *infeasible = TRUE;
+      return;
+   }
+
+   /* derive bounds of the columns from the slacks of the sides */
+   if( (rhsinf || nmininf > 1) && (lhsinf || nmaxinf > 1) )
+      return;
+
+   for( k = 0; k < nrowcols && !(*infeasible); ++k )
+   {
+      SCIP_Real val = rowvals[k];
+      SCIP_Real lb = job->lbs[rowcols[k]];
+      SCIP_Real ub = job->ubs[rowcols[k]];
+      SCIP_Real minbound = (val > 0.0) ? lb : ub;
+      SCIP_Real maxbound = (val > 0.0) ? ub : lb;
+      SCIP_Bool mininf = isContributionInfinite(scip, val, minbound);
+      SCIP_Bool maxinf = isContributionInfinite(scip, val, maxbound);
+      SCIP_Real alpha;
+      SCIP_Real slack;
+
+      /* contribution range of the column */
+      alpha = REALABS(val) * (ub - lb);
+
+      /* val * x <= rhs - minimal residual activity */
+      if( !rhsinf )
+      {
+         if( mininf && nmininf == 1 )
+         {
+            /* the column is the only one with an infinite contribution: its bound follows from the other columns */
+            tightenColBoundJob(job, rowcols[k], val > 0.0 ? SCIP_BOUNDTYPE_UPPER : SCIP_BOUNDTYPE_LOWER,
+               (rhs - minact) / val, nchanged, queueend, nqueued, infeasible);
+         }
+         else if( !mininf && nmininf == 0 )
+         {
+            /* a slack that is zero within tolerances is set to zero */
+            slack = rhs - minact;
+            if( !SCIPisPositive(scip, slack) )
+               slack = 0.0;
+
+            if( SCIPisSumGT(scip, alpha, slack) )
+            {
+               tightenColBoundJob(job, rowcols[k], val > 0.0 ? SCIP_BOUNDTYPE_UPPER : SCIP_BOUNDTYPE_LOWER,
+                  minbound + slack / val, nchanged, queueend, nqueued, infeasible);
+            }
+         }
+      }
+
+      /* val * x >= lhs - maximal residual activity */
+      if( !lhsinf && !(*infeasible) )
+      {
+         if( maxinf && nmaxinf == 1 )
+         {
+            tightenColBoundJob(job, rowcols[k], val > 0.0 ? SCIP_BOUNDTYPE_LOWER : SCIP_BOUNDTYPE_UPPER,
+               (lhs - maxact) / val, nchanged, queueend, nqueued, infeasible);
+         }
+         else if( !maxinf && nmaxinf == 0 )
+         {
+            slack = maxact - lhs;
+            if( !SCIPisPositive(scip, slack) )
+               slack = 0.0;
+
+            if( SCIPisSumGT(scip, alpha, slack) )
+            {
+               tightenColBoundJob(job, rowcols[k], val > 0.0 ? SCIP_BOUNDTYPE_LOWER : SCIP_BOUNDTYPE_UPPER,
+                  maxbound - slack / val, nchanged, queueend, nqueued, infeasible);
+            }
+         }
+      }
+   }
+}
+
+/** fixes a binary column in the private domains of a parallel probing job, propagates the rows of the constraint
+ *  matrix, and stores the resulting bound changes in the result arrays of the job
+ */
+static
+SCIP_RETCODE probeColJob(
+   PROBINGJOB*           job,                /**< parallel probing job */
+   int                   probecol,           /**< column to probe on */
+   SCIP_Real             val,                /**< value to fix the column to */
+   SCIP_Bool*            infeasible          /**< pointer to store whether the fixing is infeasible */
+   )
+{
+   int queuebegin;
+   int queueend;
+   int nqueued;
+   int nchanged;
+   int nrounds;
+   int nroundrows;
+   int k;
+
+   queuebegin = 0;
+   queueend = 0;
+   nqueued = 0;
+   nchanged = 0;
+   *infeasible = FALSE;
+
+   if( val > 0.5 )
+      tightenColBoundJob(job, probecol, SCIP_BOUNDTYPE_LOWER, val, &nchanged, &queueend, &nqueued, infeasible);
+   else
+      tightenColBoundJob(job, probecol, SCIP_BOUNDTYPE_UPPER, val, &nchanged, &queueend, &nqueued, infeasible);
+
+   /* process the queue in rounds; a round consists of the rows that were in the queue at its start */
+   nrounds = 0;
+   nroundrows = nqueued;
+   while( nqueued > 0 && !(*infeasible) && (job->maxproprounds < 0 || nrounds < job->maxproprounds) )
+   {
+      int row;
+
+      row = job->rowqueue[queuebegin];
+      queuebegin = (queuebegin + 1) % SCIPmatrixGetNRows(job->matrix);
+      --nqueued;
+      job->rowinqueue[row] = FALSE;
+
+      propagateRowJob(job, row, &nchanged, &queueend, &nqueued, infeasible);
+
+      if( --nroundrows == 0 )
+      {
+         ++nrounds;
+         nroundrows = nqueued;
+      }
+   }
+
+   /* clear the remaining queue */
+   while( nqueued > 0 )
+   {
+      job->rowinqueue[job->rowqueue[queuebegin]] = FALSE;
+      queuebegin = (queuebegin + 1) % SCIPmatrixGetNRows(job->matrix);
+      --nqueued;
+   }
+
+   /* store the bound changes of a feasible probe */
+   if( !(*infeasible) )
+   {
+      if( job->nres + nchanged > job->ressize )
+      {
+         job->ressize = MAX(2 * job->ressize, job->nres + nchanged);
+         SCIP_ALLOC( BMSreallocMemoryArray(&job->rescols, job->ressize) );
+         SCIP_ALLOC( BMSreallocMemoryArray(&job->reslbs, job->ressize) );
+         SCIP_ALLOC( BMSreallocMemoryArray(&job->resubs, job->ressize) );
+      }
+
+      for( k = 0; k < nchanged; ++k )
+      {
+         int col = job->changedcols[k];
+
+         job->rescols[job->nres] = col;
+         job->reslbs[job->nres] = job->lbs[col];
+         job->resubs[job->nres] = job->ubs[col];
+         ++job->nres;
+      }
+   }
+
+   /* reset the private domains */
+   for( k = 0; k < nchanged; ++k )
+   {
+      int col = job->changedcols[k];
+
+      job->lbs[col] = job->baselbs[col];
+      job->ubs[col] = job->baseubs[col];
+      job->colchanged[col] = FALSE;
+   }
+
+   return SCIP_OKAY;
+}
+
+/** job function of the parallel probing mode: probes each column of the job on zero and one */
+static
+SCIP_RETCODE solveProbingJob(
+   void*                 args                /**< the job data of type PROBINGJOB */
+   )
+{
+   PROBINGJOB* job;
+   int ncols;
+   int k;
+
+   job = (PROBINGJOB*)args;
+   assert(job != NULL);
+
+   ncols = SCIPmatrixGetNColumns(job->matrix);
+   BMScopyMemoryArray(job->lbs, job->baselbs, ncols);
+   BMScopyMemoryArray(job->ubs, job->baseubs, ncols);
+
+   job->nres = 0;
+   for( k = 0; k < job->nprobecols; ++k )
+   {
+      job->resbegs[2 * k] = job->nres;
+      SCIP_CALL( probeColJob(job, job->probecols[k], 0.0, &job->rescutoffs[2 * k]) );
+
+      job->resbegs[2 * k + 1] = job->nres;
+      SCIP_CALL( probeColJob(job, job->probecols[k], 1.0, &job->rescutoffs[2 * k + 1]) );
+   }
+   job->resbegs[2 * job->nprobecols] = job->nres;
+
+   return SCIP_OKAY;
+}
+
+/** the probing loop of the parallel probing mode during presolving
+ *
+ *  The binary variables are probed in rounds. In each round, every thread gets a batch of the next PROBING_NVARSPERJOB
+ *  variables in the sorted order and probes them on a private copy of the global domains by propagating the rows of the
+ *  constraint matrix only. Since this is a relaxation of the problem, all deductions are valid. The results are then
+ *  analyzed by SCIPanalyzeDeductionsProbing() in the sorted order of the variables, which applies the fixings,
+ *  aggregations, implications, and bound changes, such that the result does not depend on the timing of the threads.
+ *  Probing in parallel does not use the implication graph, the clique table, and the propagators of SCIP, but it can
+ *  probe on many more variables within the same time.
+ */
+static
+SCIP_RETCODE applyProbingParallel(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_PROPDATA*        propdata,           /**< propagator data */
+   SCIP_MATRIX*          matrix,             /**< constraint matrix */
+   SCIP_VAR**            vars,               /**< problem variables */
+   int                   nbinvars,           /**< number of binary variables */
+   int*                  startidx,           /**< pointer to store starting variable index of next call */
+   int*                  nfixedvars,         /**< pointer to store number of fixed variables */
+   int*                  naggrvars,          /**< pointer to store number of aggregated variables */
+   int*                  nchgbds,            /**< pointer to store number of changed bounds */
+   int                   oldnfixedvars,      /**< number of previously fixed variables */
+   int                   oldnaggrvars,       /**< number of previously aggregated variables */
+   SCIP_Bool*            delay,              /**< pointer to store whether propagator should be delayed */
+   SCIP_Bool*            cutoff              /**< pointer to store whether cutoff occured */
+   )
+{
+   SCIP_RETCODE retcode;
+   PROBINGJOB* jobs;
+   SCIP_VAR** unionvars;
+   SCIP_Real* baselbs;
+   SCIP_Real* baseubs;
+   SCIP_Real* leftlbs;
+   SCIP_Real* leftubs;
+   SCIP_Real* rightlbs;
+   SCIP_Real* rightubs;
+   SCIP_Bool* isintegral;
+   int* colofvar;
+   int* unionpos;
+   int maxfixings;
+   int maxuseless;
+   int maxtotaluseless;
+   int maxsumuseless;
+   int ntotalvars;
+   int ncols;
+   int nrows;
+   int njobs;
+   int i;
+   int b;
+   int c;
+   SCIP_Bool aborted;
+
+   assert(scip != NULL);
+   assert(propdata != NULL);
+   assert(propdata->nthreads > 1);
+   assert(matrix != NULL);
+   assert(vars != NULL);
+   assert(nbinvars > 0);
+
+   maxfixings = (propdata->maxfixings > 0 ? propdata->maxfixings : INT_MAX);
+   maxuseless = (propdata->maxuseless > 0 ? propdata->maxuseless : INT_MAX);
+   maxtotaluseless = (propdata->maxtotaluseless > 0 ? propdata->maxtotaluseless : INT_MAX);
+   maxsumuseless = (propdata->maxsumuseless > 0 ? propdata->maxsumuseless : INT_MAX);
+   aborted = FALSE;
+   *delay = FALSE;
+   *cutoff = FALSE;
+
+   ncols = SCIPmatrixGetNColumns(matrix);
+   nrows = SCIPmatrixGetNRows(matrix);
+   ntotalvars = SCIPgetNTotalVars(scip);
+   njobs = propdata->nthreads;
+
+   /* map the variables to the columns by their indices, which do not change when variables are fixed or aggregated */
+   SCIP_CALL( SCIPallocBufferArray(scip, &colofvar, ntotalvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &baselbs, ncols) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &baseubs, ncols) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &isintegral, ncols) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &unionvars, ncols) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &unionpos, ncols) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &leftlbs, ncols) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &leftubs, ncols) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &rightlbs, ncols) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &rightubs, ncols) );
+
+   for( i = 0; i < ntotalvars; ++i )
+      colofvar[i] = -1;
+
+   for( c = 0; c < ncols; ++c )
+   {
+      SCIP_VAR* var = SCIPmatrixGetVar(matrix, c);
+
+      assert(SCIPvarGetIndex(var) < ntotalvars);
+      colofvar[SCIPvarGetIndex(var)] = c;
+      isintegral[c] = SCIPvarIsIntegral(var);
+      unionpos[c] = -1;
+   }
+
+   SCIP_CALL( SCIPallocClearBufferArray(scip, &jobs, njobs) );
+   for( b = 0; b < njobs; ++b )
+   {
+      jobs[b].scip = scip;
+      jobs[b].matrix = matrix;
+      jobs[b].baselbs = baselbs;
+      jobs[b].baseubs = baseubs;
+      jobs[b].isintegral = isintegral;
+      jobs[b].maxproprounds = (propdata->proprounds > 0 ? propdata->proprounds : -1);
+
+      SCIP_CALL( SCIPallocBufferArray(scip, &jobs[b].lbs, ncols) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &jobs[b].ubs, ncols) );
+      SCIP_CALL( SCIPallocClearBufferArray(scip, &jobs[b].colchanged, ncols) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &jobs[b].changedcols, ncols) );
+      SCIP_CALL( SCIPallocClearBufferArray(scip, &jobs[b].rowinqueue, MAX(nrows, 1)) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &jobs[b].rowqueue, MAX(nrows, 1)) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &jobs[b].probecols, PROBING_NVARSPERJOB) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &jobs[b].probeidxs, PROBING_NVARSPERJOB) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &jobs[b].resbegs, 2 * PROBING_NVARSPERJOB + 1) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &jobs[b].rescutoffs, 2 * PROBING_NVARSPERJOB) );
+   }
+
+   SCIP_CALL( SCIPtpiInit(njobs, INT_MAX, FALSE) );
+
+   retcode = SCIP_OKAY;
+   i = *startidx;
+   while( i < nbinvars && !(*cutoff) && !(*delay) && !aborted )
+   {
+      int nprobecols;
+      int jobid;
+
+      /* distribute the next unfixed binary variables in batches to the jobs */
+      nprobecols = 0;
+      for( b = 0; b < njobs; ++b )
+      {
+         jobs[b].nprobecols = 0;
+         for( ; i < nbinvars && jobs[b].nprobecols < PROBING_NVARSPERJOB; ++i )
+         {
+            c = colofvar[SCIPvarGetIndex(vars[i])];
+
+            if( c < 0 || !SCIPvarIsActive(vars[i]) || SCIPvarIsDeleted(vars[i])
+               || SCIPvarGetLbLocal(vars[i]) > 0.5 || SCIPvarGetUbLocal(vars[i]) < 0.5 )
+               continue;
+
+            jobs[b].probecols[jobs[b].nprobecols] = c;
+            jobs[b].probeidxs[jobs[b].nprobecols] = i;
+            ++jobs[b].nprobecols;
+         }
+         nprobecols += jobs[b].nprobecols;
+      }
+
+      if( nprobecols == 0 )
+         break;
+
+      /* all jobs of the round start from the current global domains */
+      for( c = 0; c < ncols; ++c )
+      {
+         baselbs[c] = SCIPvarGetLbGlobal(SCIPmatrixGetVar(matrix, c));
+         baseubs[c] = SCIPvarGetUbGlobal(SCIPmatrixGetVar(matrix, c));
+      }
+
+      /* probe the batches concurrently */
+      jobid = SCIPtpiGetNewJobID();
+
+      TPI_PARA
+      {
+         TPI_SINGLE
+         {
+            for( b = 0; b < njobs; ++b )
+            {
+               /* cppcheck-suppress unassignedVariable */
+               SCIP_JOB* job;
+               SCIP_SUBMITSTATUS status;
+
+               if( jobs[b].nprobecols == 0 )
+                  continue;
+
+               SCIP_CALL_ABORT( SCIPtpiCreateJob(&job, jobid, solveProbingJob, &jobs[b]) );
+               SCIP_CALL_ABORT( SCIPtpiSubmitJob(job, &status) );
+
+               assert(status == SCIP_SUBMIT_SUCCESS);
+            }
+         }
+      }
+
+      SCIP_CALL_TERMINATE( retcode, SCIPtpiCollectJobs(jobid), TERMINATE );
+
+      /* analyze the probing results in the order of the variables */
+      for( b = 0; b < njobs && !(*cutoff) && !(*delay) && !aborted; ++b )
+      {
+         PROBINGJOB* job = &jobs[b];
+         int k;
+
+         for( k = 0; k < job->nprobecols; ++k )
+         {
+            SCIP_VAR* var;
+            SCIP_Bool probingzero;
+            SCIP_Bool probingone;
+            SCIP_Bool fixed;
+            int localnfixedvars;
+            int localnaggrvars;
+            int localnimplications;
+            int localnchgbds;
+            int nunionvars;
+            int r;
+
+            var = vars[job->probeidxs[k]];
+
+            /* check whether probing should be aborted or enough variables were fixed; the next call starts here */
+            if( propdata->nuseless >= maxuseless || propdata->ntotaluseless >= maxtotaluseless
+               || propdata->nsumuseless >= maxsumuseless || SCIPisStopped(scip) )
+            {
+               SCIPverbMessage(scip, SCIP_VERBLEVEL_HIGH, NULL,
+                  "   (%.1fs) probing aborted: %d/%d (%.1f%%) - %d fixings, %d aggregations, %d implications, %d bound changes\n",
+                  SCIPgetSolvingTime(scip), job->probeidxs[k]+1, nbinvars, 100.0*(SCIP_Real)(job->probeidxs[k]+1)/(SCIP_Real)nbinvars,
+                  propdata->nfixings, propdata->naggregations, propdata->nimplications, propdata->nbdchgs);
+
+               aborted = TRUE;
+            }
+            else if( *nfixedvars - oldnfixedvars + *naggrvars - oldnaggrvars >= maxfixings )
+               *delay = TRUE;
+
+            if( aborted || *delay )
+            {
+               i = job->probeidxs[k];
+               break;
+            }
+
+            /* ignore variables that were fixed or aggregated by the results of previous variables */
+            if( !SCIPvarIsActive(var) || SCIPvarGetLbLocal(var) > 0.5 || SCIPvarGetUbLocal(var) < 0.5 )
+               continue;
+
+            if( propdata->nuseless > 0 )
+               propdata->nsumuseless++;
+            else
+               propdata->nsumuseless = MAX(propdata->nsumuseless-1, 0);
+            propdata->nuseless++;
+            propdata->ntotaluseless++;
+
+            /* the directions without locks are ignored as in sequential probing */
+            probingone = (SCIPvarGetNLocksUpType(var, SCIP_LOCKTYPE_MODEL) > 0);
+            probingzero = (SCIPvarGetNLocksDownType(var, SCIP_LOCKTYPE_MODEL) > 0);
+
+            if( (probingone && job->rescutoffs[2 * k + 1]) || (probingzero && job->rescutoffs[2 * k]) )
+            {
+               SCIP_Real fixval = (probingone && job->rescutoffs[2 * k + 1]) ? 0.0 : 1.0;
+
+               SCIP_CALL_TERMINATE( retcode, SCIPfixVar(scip, var, fixval, cutoff, &fixed), TERMINATE );
+
+               if( fixed )
+               {
+                  SCIPdebugMsg(scip, "fixed probing variable <%s> to %g in parallel probing\n", SCIPvarGetName(var), fixval);
+                  (*nfixedvars)++;
+                  propdata->nfixings++;
+                  propdata->nuseless = 0;
+                  propdata->ntotaluseless = 0;
+               }
+
+               if( *cutoff )
+                  break;
+
+               continue;
+            }
+
+            if( !probingzero || !probingone )
+               continue;
+
+            propdata->nprobed[SCIPvarGetIndex(var)] += 1;
+
+            /* collect the columns changed in one of the directions; unchanged bounds are the ones of the round */
+            nunionvars = 0;
+            for( r = job->resbegs[2 * k]; r < job->resbegs[2 * k + 2]; ++r )
+            {
+               c = job->rescols[r];
+
+               if( unionpos[c] < 0 )
+               {
+                  SCIP_VAR* unionvar = SCIPmatrixGetVar(matrix, c);
+
+                  if( unionvar == var || SCIPvarGetStatus(unionvar) == SCIP_VARSTATUS_MULTAGGR )
+                     continue;
+
+                  unionpos[c] = nunionvars;
+                  unionvars[nunionvars] = unionvar;
+                  leftlbs[nunionvars] = baselbs[c];
+                  leftubs[nunionvars] = baseubs[c];
+                  rightlbs[nunionvars] = baselbs[c];
+                  rightubs[nunionvars] = baseubs[c];
+                  ++nunionvars;
+               }
+
+               if( r < job->resbegs[2 * k + 1] )
+               {
+                  leftlbs[unionpos[c]] = job->reslbs[r];
+                  leftubs[unionpos[c]] = job->resubs[r];
+               }
+               else
+               {
+                  rightlbs[unionpos[c]] = job->reslbs[r];
+                  rightubs[unionpos[c]] = job->resubs[r];
+               }
+            }
+
+            for( r = 0; r < nunionvars; ++r )
+               unionpos[colofvar[SCIPvarGetIndex(unionvars[r])]] = -1;
+
+            localnfixedvars    = 0;
+            localnaggrvars     = 0;
+            localnimplications = 0;
+            localnchgbds       = 0;
+            SCIP_CALL_TERMINATE( retcode, SCIPanalyzeDeductionsProbing(scip, var, 0.0, 1.0, nunionvars, unionvars,
+                  NULL, NULL, leftlbs, leftubs, NULL, NULL, rightlbs, rightubs,
+                  &localnfixedvars, &localnaggrvars, &localnimplications, &localnchgbds, cutoff), TERMINATE );
+
+            *nfixedvars += localnfixedvars;
+            *naggrvars  += localnaggrvars;
+            *nchgbds    += localnchgbds;
+            propdata->nfixings      += localnfixedvars;
+            propdata->naggregations += localnaggrvars;
+            propdata->nbdchgs       += localnchgbds;
+            propdata->nimplications += localnimplications;
+
+            if( localnfixedvars > 0 || localnaggrvars > 0 )
+            {
+               propdata->nuseless = 0;
+               propdata->ntotaluseless = 0;
+            }
+            if( localnimplications > 0 || localnchgbds > 0 )
+               propdata->ntotaluseless = 0;
+
+            if( *cutoff )
+               break;
+         }
+      }
+   }
+
+   /* start at the beginning in the next call if all variables were probed */
+   *startidx = (i >= nbinvars) ? 0 : i;
+
+TERMINATE:
+   /* the thread pool has to be released in any case */
+   if( retcode == SCIP_OKAY )
+   {
+      retcode = SCIPtpiExit();
+   }
+   else
+   {
+      (void) SCIPtpiExit();
+   }
+
+   for( b = njobs - 1; b >= 0; --b )
+   {
+      BMSfreeMemoryArrayNull(&jobs[b].resubs);
+      BMSfreeMemoryArrayNull(&jobs[b].reslbs);
+      BMSfreeMemoryArrayNull(&jobs[b].rescols);
+      SCIPfreeBufferArray(scip, &jobs[b].rescutoffs);
+      SCIPfreeBufferArray(scip, &jobs[b].resbegs);
+      SCIPfreeBufferArray(scip, &jobs[b].probeidxs);
+      SCIPfreeBufferArray(scip, &jobs[b].probecols);
+      SCIPfreeBufferArray(scip, &jobs[b].rowqueue);
+      SCIPfreeBufferArray(scip, &jobs[b].rowinqueue);
+      SCIPfreeBufferArray(scip, &jobs[b].changedcols);
+      SCIPfreeBufferArray(scip, &jobs[b].colchanged);
+      SCIPfreeBufferArray(scip, &jobs[b].ubs);
+      SCIPfreeBufferArray(scip, &jobs[b].lbs);
+   }
+   SCIPfreeBufferArray(scip, &jobs);
+   SCIPfreeBufferArray(scip, &rightubs);
+   SCIPfreeBufferArray(scip, &rightlbs);
+   SCIPfreeBufferArray(scip, &leftubs);
+   SCIPfreeBufferArray(scip, &leftlbs);
+   SCIPfreeBufferArray(scip, &unionpos);
+   SCIPfreeBufferArray(scip, &unionvars);
+   SCIPfreeBufferArray(scip, &isintegral);
+   SCIPfreeBufferArray(scip, &baseubs);
+   SCIPfreeBufferArray(scip, &baselbs);
+   SCIPfreeBufferArray(scip, &colofvar);
+
+   return retcode;
+}
+
 /*
  * Callback methods of propagator
  */
@@ -873,6 +1654,7 @@ SCIP_DECL_PROPPRESOL(propPresolProbing)
    int oldnchgbds;
    int oldnimplications;
    int ntotalvars;
+   SCIP_Bool parallel;
    SCIP_Bool delay;
    SCIP_Bool cutoff;
 
@@ -969,9 +1751,47 @@ SCIP_DECL_PROPPRESOL(propPresolProbing)
    oldnchgbds = *nchgbds;
    oldnimplications = propdata->nimplications;
 
+   /* probe in parallel on the rows of the constraint matrix if requested, if this is not a sub-SCIP (whose caller may
+    * already run on a worker thread) and if the task processing interface is not in use
+    */
+   parallel = FALSE;
+   if( propdata->nthreads > 1 && SCIPgetSubscipDepth(scip) == 0 && SCIPtpiIsAvailable()
+      && !SCIPsyncstoreIsInitialized(SCIPgetSyncstore(scip)) )
+   {
+      SCIP_MATRIX* matrix;
+      SCIP_Bool initialized;
+      SCIP_Bool complete;
+      SCIP_Bool infeasible;
+
+      SCIP_CALL( SCIPmatrixCreate(scip, &matrix, FALSE, &initialized, &complete, &infeasible,
+            naddconss, ndelconss, nchgcoefs, nchgbds, nfixedvars) );
+
+      if( infeasible )
+      {
+         if( initialized )
+            SCIPmatrixFree(scip, &matrix);
+
+         *result = SCIP_CUTOFF;
+         return SCIP_OKAY;
+      }
+
+      if( initialized )
+      {
+         SCIP_CALL( applyProbingParallel(scip, propdata, matrix, propdata->sortedvars, propdata->nsortedbinvars,
+               &(propdata->startidx), nfixedvars, naggrvars, nchgbds, oldnfixedvars, oldnaggrvars, &delay, &cutoff) );
+
+         SCIPmatrixFree(scip, &matrix);
+         parallel = TRUE;
+         ++propdata->nparallelcalls;
+      }
+   }
+
    /* start probing on variables */
-   SCIP_CALL( applyProbing(scip, propdata, propdata->sortedvars, propdata->nsortedvars, propdata->nsortedbinvars,
-         &(propdata->startidx), nfixedvars, naggrvars, nchgbds, oldnfixedvars, oldnaggrvars, &delay, &cutoff) );
+   if( !parallel )
+   {
+      SCIP_CALL( applyProbing(scip, propdata, propdata->sortedvars, propdata->nsortedvars, propdata->nsortedbinvars,
+            &(propdata->startidx), nfixedvars, naggrvars, nchgbds, oldnfixedvars, oldnaggrvars, &delay, &cutoff) );
+   }
 
    /* adjust result code */
    if( cutoff )
@@ -1193,6 +2013,10 @@ SCIP_RETCODE SCIPincludePropProbing(
          "propagating/" PROP_NAME "/maxdepth",
          "maximal depth until propagation is executed(-1: no limit)",
          &propdata->maxdepth, TRUE, DEFAULT_MAXDEPTH, -1, INT_MAX, NULL, NULL) );
+   SCIP_CALL( SCIPaddIntParam(scip,
+         "propagating/" PROP_NAME "/nthreads",
+         "number of threads used to probe in parallel during presolving on the rows of the constraint matrix only (1: sequential)",
+         &propdata->nthreads, TRUE, DEFAULT_NTHREADS, 1, 64, NULL, NULL) );
 
    return SCIP_OKAY;
 }
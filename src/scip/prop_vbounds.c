@@ -191,16 +191,15 @@ struct SCIP_PropData
                                               *   and boundtype represented by index topoorder[i] are earlier in the
                                               *   topological order than those represented by index topoorder[j]
                                               */
-   int**                 vboundboundedidx;   /**< array storing for each bound index the bound indices of all bounds
-                                              *   influenced by this bound through variable bounds */
-   SCIP_Real**           vboundcoefs;        /**< array storing for each bound index the coefficients in the variable
-                                              *   bounds influencing the corresponding bound index stored in
-                                              *   vboundboundedidx */
-   SCIP_Real**           vboundconstants;    /**< array storing for each bound index the constants in the variable
-                                              *   bounds influencing the corresponding bound index stored in
-                                              *   vboundboundedidx */
-   int*                  nvbounds;           /**< array storing for each bound index the number of vbounds stored */
-   int*                  vboundsize;         /**< array with sizes of vbound arrays for the nodes */
+   int*                  vboundbegs;         /**< array of size nbounds + 1 storing for each bound index the position of
+                                              *   its first variable bound in the vbound arrays (compressed row storage) */
+   int*                  vboundboundedidx;   /**< array storing consecutively for each bound index the bound indices of
+                                              *   all bounds influenced by this bound through variable bounds */
+   SCIP_Real*            vboundcoefs;        /**< array storing the coefficients in the variable bounds influencing the
+                                              *   corresponding bound index stored in vboundboundedidx */
+   SCIP_Real*            vboundconstants;    /**< array storing the constants in the variable bounds influencing the
+                                              *   corresponding bound index stored in vboundboundedidx */
+   int                   nvbounds;           /**< total number of vbounds stored */
    int                   nbounds;            /**< number of bounds of variables regarded (two times number of active variables) */
    int                   lastpresolncliques; /**< number of cliques created until the last call to the presolver */
    SCIP_PQUEUE*          propqueue;          /**< priority queue to handle the bounds of variables that were changed and have to be propagated */
@@ -340,11 +339,11 @@ void resetPropdata(
    propdata->vars = NULL;
    propdata->varhashmap = NULL;
    propdata->topoorder = NULL;
+   propdata->vboundbegs = NULL;
    propdata->vboundboundedidx = NULL;
    propdata->vboundcoefs = NULL;
    propdata->vboundconstants = NULL;
-   propdata->nvbounds = NULL;
-   propdata->vboundsize = NULL;
+   propdata->nvbounds = 0;
    propdata->nbounds = 0;
    propdata->initialized = FALSE;
 }
@@ -390,7 +389,7 @@ SCIP_RETCODE catchEvents(
        * we do not create an event and do not catch changes of the bound;
        * we mark this by setting the value in topoorder to -1
        */
-      if( propdata->nvbounds[idx] == 0 && SCIPvarGetNImpls(var, lower) == 0 && SCIPvarGetNCliques(var, lower) == 0 )
+      if( propdata->vboundbegs[idx + 1] == propdata->vboundbegs[idx] && SCIPvarGetNImpls(var, lower) == 0 && SCIPvarGetNCliques(var, lower) == 0 )
       {
          propdata->topoorder[v] = -1;
          continue;
@@ -456,53 +455,6 @@ SCIP_RETCODE dropEvents(
    return SCIP_OKAY;
 }
 
-#define INITMEMSIZE 5
-
-/* adds a vbound to the propagator data to store it internally and allow forward propagation */
-static
-SCIP_RETCODE addVbound(
-   SCIP*                 scip,               /**< SCIP data structure */
-   SCIP_PROPDATA*        propdata,           /**< propagator data */
-   int                   startidx,           /**< index of bound of variable influencing the other variable */
-   int                   endidx,             /**< index of bound of variable which is influenced */
-   SCIP_Real             coef,               /**< coefficient in the variable bound */
-   SCIP_Real             constant            /**< constant in the variable bound */
-   )
-{
-   int nvbounds;
-
-   assert(scip != NULL);
-   assert(propdata != NULL);
-
-   if( propdata->vboundsize[startidx] == 0 )
-   {
-      /* allocate memory for storing vbounds */
-      propdata->vboundsize[startidx] = INITMEMSIZE;
-
-      SCIP_CALL( SCIPreallocMemoryArray(scip, &propdata->vboundboundedidx[startidx], propdata->vboundsize[startidx]) ); /*lint !e866*/
-      SCIP_CALL( SCIPreallocMemoryArray(scip, &propdata->vboundcoefs[startidx], propdata->vboundsize[startidx]) ); /*lint !e866*/
-      SCIP_CALL( SCIPreallocMemoryArray(scip, &propdata->vboundconstants[startidx], propdata->vboundsize[startidx]) ); /*lint !e866*/
-   }
-   else if( propdata->nvbounds[startidx] >= propdata->vboundsize[startidx] )
-   {
-      /* reallocate memory for storing vbounds */
-      propdata->vboundsize[startidx] = SCIPcalcMemGrowSize(scip, propdata->nvbounds[startidx] + 1);
-      assert(propdata->nvbounds[startidx] < propdata->vboundsize[startidx]);
-
-      SCIP_CALL( SCIPreallocMemoryArray(scip, &propdata->vboundboundedidx[startidx], propdata->vboundsize[startidx]) ); /*lint !e866*/
-      SCIP_CALL( SCIPreallocMemoryArray(scip, &propdata->vboundcoefs[startidx], propdata->vboundsize[startidx]) ); /*lint !e866*/
-      SCIP_CALL( SCIPreallocMemoryArray(scip, &propdata->vboundconstants[startidx], propdata->vboundsize[startidx]) ); /*lint !e866*/
-   }
-
-   nvbounds = propdata->nvbounds[startidx];
-   propdata->vboundboundedidx[startidx][nvbounds] = endidx;
-   propdata->vboundcoefs[startidx][nvbounds] = coef;
-   propdata->vboundconstants[startidx][nvbounds] = constant;
-   (propdata->nvbounds[startidx])++;
-
-   return SCIP_OKAY;
-}
-
 /** comparison method for two indices in the topoorder array, preferring higher indices because the order is reverse
  *  topological
  */
@@ -725,17 +677,17 @@ SCIP_RETCODE extractCycle(
       {
          assert(stacknextedge[j] > ntmpimpls);
 
-         k = stacknextedge[j] - ntmpimpls - 1;
-         assert(k < propdata->nvbounds[dfsstack[j]]);
-         assert(propdata->vboundboundedidx[dfsstack[j]][k] == dfsstack[j+1]);
+         k = propdata->vboundbegs[dfsstack[j]] + stacknextedge[j] - ntmpimpls - 1;
+         assert(k < propdata->vboundbegs[dfsstack[j] + 1]);
+         assert(propdata->vboundboundedidx[k] == dfsstack[j+1]);
 
          SCIPdebugMsg(scip, "%s(%s) -- (*%g + %g) --> %s(%s)\n",
             indexGetBoundString(dfsstack[j]), SCIPvarGetName(vars[getVarIndex(dfsstack[j])]),
-            propdata->vboundcoefs[dfsstack[j]][k], propdata->vboundconstants[dfsstack[j]][k],
+            propdata->vboundcoefs[k], propdata->vboundconstants[k],
             indexGetBoundString(dfsstack[j+1]), SCIPvarGetName(vars[getVarIndex(dfsstack[j+1])]));
 
-         coef = coef * propdata->vboundcoefs[dfsstack[j]][k];
-         constant = constant * propdata->vboundcoefs[dfsstack[j]][k] + propdata->vboundconstants[dfsstack[j]][k];
+         coef = coef * propdata->vboundcoefs[k];
+         constant = constant * propdata->vboundcoefs[k] + propdata->vboundconstants[k];
       }
    }
 
@@ -1055,8 +1007,8 @@ SCIP_RETCODE dfs(
          int* vboundidx;
          int i;
 
-         nvbounds = propdata->nvbounds[curridx];
-         vboundidx = propdata->vboundboundedidx[curridx];
+         nvbounds = propdata->vboundbegs[curridx + 1] - propdata->vboundbegs[curridx];
+         vboundidx = &propdata->vboundboundedidx[propdata->vboundbegs[curridx]];
 
          /* iterate over all vbounds for the given bound */
          for( i = stacknextedge[stacksize - 1] - nimpls; i < nvbounds; ++i )
@@ -1182,6 +1134,11 @@ SCIP_RETCODE initData(
 {
    SCIP_PROPDATA* propdata;
    SCIP_VAR** vars;
+   SCIP_Real* tmpcoefs;
+   SCIP_Real* tmpconstants;
+   int* tmpstartidx;
+   int* tmpendidx;
+   int ntmpvbounds;
    int nvars;
    int nbounds;
    int startidx;
@@ -1231,26 +1188,23 @@ SCIP_RETCODE initData(
 
    /* allocate memory for the arrays of the propdata */
    SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->topoorder, nbounds) );
-   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->vboundboundedidx, nbounds) );
-   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->vboundcoefs, nbounds) );
-   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->vboundconstants, nbounds) );
-   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->nvbounds, nbounds) );
-   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->vboundsize, nbounds) );
-   BMSclearMemoryArray(propdata->vboundboundedidx, nbounds);
-   BMSclearMemoryArray(propdata->vboundcoefs, nbounds);
-   BMSclearMemoryArray(propdata->vboundconstants, nbounds);
-   BMSclearMemoryArray(propdata->nvbounds, nbounds);
-   BMSclearMemoryArray(propdata->vboundsize, nbounds);
+   SCIP_CALL( SCIPallocClearBlockMemoryArray(scip, &propdata->vboundbegs, nbounds + 1) );
 
    for( v = 0; v < nbounds; ++v )
-   {
       propdata->topoorder[v] = v;
-      propdata->vboundboundedidx[v] = NULL;
-      propdata->vboundcoefs[v] = NULL;
-      propdata->vboundconstants[v] = NULL;
-      propdata->nvbounds[v] = 0;
-      propdata->vboundsize[v] = 0;
-   }
+
+   /* the variable bounds are first collected as a list of edges and afterwards stored in compressed row storage; the
+    * number of variable bounds of the variables is an upper bound on the number of edges
+    */
+   ntmpvbounds = 0;
+   for( v = 0; v < nvars; ++v )
+      ntmpvbounds += SCIPvarGetNVlbs(vars[v]) + SCIPvarGetNVubs(vars[v]);
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &tmpstartidx, ntmpvbounds) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &tmpendidx, ntmpvbounds) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &tmpcoefs, ntmpvbounds) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &tmpconstants, ntmpvbounds) );
+   ntmpvbounds = 0;
 
    /* collect information about varbounds */
    for( v = 0; v < nbounds; ++v )
@@ -1322,7 +1276,12 @@ SCIP_RETCODE initData(
          }
          else
          {
-            SCIP_CALL( addVbound(scip, propdata, startidx, v, coef, constant) );
+            tmpstartidx[ntmpvbounds] = startidx;
+            tmpendidx[ntmpvbounds] = v;
+            tmpcoefs[ntmpvbounds] = coef;
+            tmpconstants[ntmpvbounds] = constant;
+            ++ntmpvbounds;
+            ++propdata->vboundbegs[startidx + 1];
 
             SCIPdebugMsg(scip, "varbound <%s> %s %g * <%s> + %g added to propagator data\n",
                SCIPvarGetName(var), (lower ? ">=" : "<="), coef,
@@ -1331,6 +1290,39 @@ SCIP_RETCODE initData(
       }
    }
 
+   /* store the variable bounds in compressed row storage, keeping the order of the variable bounds of each bound index */
+   for( v = 0; v < nbounds; ++v )
+      propdata->vboundbegs[v + 1] += propdata->vboundbegs[v];
+   assert(propdata->vboundbegs[nbounds] == ntmpvbounds);
+
+   propdata->nvbounds = ntmpvbounds;
+
+   if( ntmpvbounds > 0 )
+   {
+      int* vboundpos;
+
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->vboundboundedidx, ntmpvbounds) );
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->vboundcoefs, ntmpvbounds) );
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->vboundconstants, ntmpvbounds) );
+      SCIP_CALL( SCIPduplicateBufferArray(scip, &vboundpos, propdata->vboundbegs, nbounds) );
+
+      for( n = 0; n < ntmpvbounds; ++n )
+      {
+         int pos = vboundpos[tmpstartidx[n]]++;
+
+         propdata->vboundboundedidx[pos] = tmpendidx[n];
+         propdata->vboundcoefs[pos] = tmpcoefs[n];
+         propdata->vboundconstants[pos] = tmpconstants[n];
+      }
+
+      SCIPfreeBufferArray(scip, &vboundpos);
+   }
+
+   SCIPfreeBufferArray(scip, &tmpconstants);
+   SCIPfreeBufferArray(scip, &tmpcoefs);
+   SCIPfreeBufferArray(scip, &tmpendidx);
+   SCIPfreeBufferArray(scip, &tmpstartidx);
+
    /* sort the bounds topologically */
    if( propdata->dotoposort )
    {
@@ -2055,17 +2047,17 @@ SCIP_RETCODE propagateVbounds(
          SCIP_Real constant;
 
          /* iterate over all vbounds for the given bound */
-         for( n = 0; n < propdata->nvbounds[startpos]; ++n )
+         for( n = propdata->vboundbegs[startpos]; n < propdata->vboundbegs[startpos + 1]; ++n )
          {
-            boundedvar = vars[getVarIndex(propdata->vboundboundedidx[startpos][n])];
-            coef = propdata->vboundcoefs[startpos][n];
-            constant = propdata->vboundconstants[startpos][n];
+            boundedvar = vars[getVarIndex(propdata->vboundboundedidx[n])];
+            coef = propdata->vboundcoefs[n];
+            constant = propdata->vboundconstants[n];
 
             /* compute new bound */
             newbound = startbound * coef + constant;
 
             /* try to tighten the bound */
-            if( isIndexLowerbound(propdata->vboundboundedidx[startpos][n]) )
+            if( isIndexLowerbound(propdata->vboundboundedidx[n]) )
             {
                SCIP_CALL( tightenVarLb(scip, prop, propdata, boundedvar, newbound, global, startvar, starttype, force,
                      coef, constant, TRUE, &nchgbds, result) );
@@ -2165,7 +2157,6 @@ static
 SCIP_DECL_PROPEXITSOL(propExitsolVbounds)
 {  /*lint --e{715}*/
    SCIP_PROPDATA* propdata;
-   int v;
 
    propdata = SCIPpropGetData(prop);
    assert(propdata != NULL);
@@ -2176,27 +2167,14 @@ SCIP_DECL_PROPEXITSOL(propExitsolVbounds)
       /* drop all variable events */
       SCIP_CALL( dropEvents(scip, propdata) );
 
-      /* release all variables */
-      for( v = 0; v < propdata->nbounds; ++v )
-      {
-         /* free vbound data */
-         if( propdata->vboundsize[v] > 0 )
-         {
-            SCIPfreeMemoryArray(scip, &propdata->vboundboundedidx[v]);
-            SCIPfreeMemoryArray(scip, &propdata->vboundcoefs[v]);
-            SCIPfreeMemoryArray(scip, &propdata->vboundconstants[v]);
-         }
-      }
-
       /* free priority queue */
       SCIPpqueueFree(&propdata->propqueue);
 
       /* free arrays */
-      SCIPfreeBlockMemoryArray(scip, &propdata->vboundsize, propdata->nbounds);
-      SCIPfreeBlockMemoryArray(scip, &propdata->nvbounds, propdata->nbounds);
-      SCIPfreeBlockMemoryArray(scip, &propdata->vboundconstants, propdata->nbounds);
-      SCIPfreeBlockMemoryArray(scip, &propdata->vboundcoefs, propdata->nbounds);
-      SCIPfreeBlockMemoryArray(scip, &propdata->vboundboundedidx, propdata->nbounds);
+      SCIPfreeBlockMemoryArrayNull(scip, &propdata->vboundconstants, propdata->nvbounds);
+      SCIPfreeBlockMemoryArrayNull(scip, &propdata->vboundcoefs, propdata->nvbounds);
+      SCIPfreeBlockMemoryArrayNull(scip, &propdata->vboundboundedidx, propdata->nvbounds);
+      SCIPfreeBlockMemoryArray(scip, &propdata->vboundbegs, propdata->nbounds + 1);
       SCIPfreeBlockMemoryArray(scip, &propdata->inqueue, propdata->nbounds);
       SCIPfreeBlockMemoryArray(scip, &propdata->topoorder, propdata->nbounds);
 
@@ -3023,28 +3001,23 @@ SCIP_DECL_PROPRESPROP(propRespropVbounds)
 
    if( !SCIPvarIsBinary(startvar) && propdata->usebdwidening )
    {
-      int* vboundboundedidx;
       SCIP_Real constant;
       SCIP_Real coef;
       int inferidx;
-      int nvbounds;
       int b;
 
-      nvbounds = propdata->nvbounds[pos];
-      vboundboundedidx = propdata->vboundboundedidx[pos];
-
       inferidx = boundtype == SCIP_BOUNDTYPE_LOWER ? varGetLbIndex(propdata, infervar) : varGetUbIndex(propdata, infervar);
       assert(inferidx >= 0);
 
-      for( b = 0; b < nvbounds; ++b )
+      for( b = propdata->vboundbegs[pos]; b < propdata->vboundbegs[pos + 1]; ++b )
       {
-         if( vboundboundedidx[b] == inferidx )
+         if( propdata->vboundboundedidx[b] == inferidx )
             break;
       }
-      assert(b < nvbounds);
+      assert(b < propdata->vboundbegs[pos + 1]);
 
-      coef = propdata->vboundcoefs[pos][b];
-      constant = propdata->vboundconstants[pos][b];
+      coef = propdata->vboundcoefs[b];
+      constant = propdata->vboundconstants[b];
       assert(!SCIPisZero(scip, coef));
 
       /* compute the relaxed bound which is sufficient to propagate the inference bound of given variable */
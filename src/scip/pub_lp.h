@@ -291,6 +291,33 @@ SCIP_Real SCIProwGetParallelism(
    char                  orthofunc           /**< function used for calc. scalar prod. ('e'uclidean, 'd'iscrete) */
    );
 
+/** computes a 64 bit signature of the columns of the row together with, for each bit of the signature, the sum of the
+ *  squared coefficients of the columns mapped to this bit relative to the squared norm of the row;
+ *  the data of two rows can be passed to SCIPgetParallelismSignatureBound() to bound their euclidean parallelism
+ *  without merging the rows
+ */
+SCIP_EXPORT
+void SCIProwGetParallelismSignature(
+   SCIP_ROW*             row,                /**< LP row */
+   uint64_t*             signature,          /**< pointer to store the signature of the columns of the row */
+   SCIP_Real*            sqrnormfracs        /**< array of size SCIP_PARALLELSIGNATURE_SIZE to store the fraction of the
+                                              *   squared norm of the row for each bit of the signature */
+   );
+
+/** returns an upper bound on the euclidean parallelism SCIProwGetParallelism(row1, row2, 'e') of two rows given their
+ *  parallelism signatures computed by SCIProwGetParallelismSignature();
+ *
+ *  The bound follows from the Cauchy-Schwarz inequality on the columns that may be common to both rows. It is zero if
+ *  the supports of the rows are disjoint and includes a safety margin for roundoff errors.
+ */
+SCIP_EXPORT
+SCIP_Real SCIPgetParallelismSignatureBound(
+   uint64_t              signature1,         /**< signature of the first row */
+   SCIP_Real*            sqrnormfracs1,      /**< squared norm fractions of the first row */
+   uint64_t              signature2,         /**< signature of the second row */
+   SCIP_Real*            sqrnormfracs2       /**< squared norm fractions of the second row */
+   );
+
 /** returns the degree of orthogonality between the hyperplanes defined by the two row vectors v, w:
  *  o = 1 - |v*w|/(|v|*|w|);
  *  the hyperplanes are orthogonal, iff p = 1, they are parallel, iff p = 0
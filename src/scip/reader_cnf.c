@@ -153,9 +153,12 @@ SCIP_RETCODE readCnf(
    SCIP_VAR** vars;
    SCIP_VAR** clausevars;
    SCIP_CONS* cons;
+   SCIP_Bool haslogicor;
+   SCIP_Bool hassetppc;
    int* varsign;
    char* tok;
    char* nexttok;
+   char* endptr;
    char line[MAXLINELEN];
    char format[SCIP_MAXSTRLEN];
    char varname[SCIP_MAXSTRLEN];
@@ -217,6 +220,10 @@ SCIP_RETCODE readCnf(
    SCIP_CALL( SCIPgetBoolParam(scip, "reading/dynamicrows", &dynamicrows) );
    SCIP_CALL( SCIPgetBoolParam(scip, "reading/cnfreader/useobj", &useobj) );
 
+   /* determine the type of the clause constraints once instead of searching the constraint handlers for each clause */
+   haslogicor = (SCIPfindConshdlr(scip, "logicor") != NULL);
+   hassetppc = (SCIPfindConshdlr(scip, "setppc") != NULL);
+
    /* get temporary memory */
    SCIP_CALL( SCIPallocBufferArray(scip, &vars, nvars) );
    SCIP_CALL( SCIPallocBufferArray(scip, &clausevars, nvars) );
@@ -247,8 +254,7 @@ SCIP_RETCODE readCnf(
          while( tok != NULL )
          {
             /* parse literal and check for errors */
-            /* coverity[secure_coding] */
-            if( sscanf(tok, "%d", &v) != 1 )
+            if( !SCIPstrToIntValue(tok, &v, &endptr) )
             {
                (void) SCIPsnprintf(s, SCIP_MAXSTRLEN, "invalid literal <%s>", tok);
                readError(scip, linecount, s);
@@ -266,13 +272,13 @@ SCIP_RETCODE readCnf(
                clausenum++;
                (void) SCIPsnprintf(s, SCIP_MAXSTRLEN, "c%d", clausenum);
 
-               if( SCIPfindConshdlr(scip, "logicor") != NULL )
+               if( haslogicor )
                {
                   /* if the constraint handler logicor exit create a logicor constraint */
                   SCIP_CALL( SCIPcreateConsLogicor(scip, &cons, s, clauselen, clausevars,
                         initialconss, TRUE, TRUE, TRUE, TRUE, FALSE, FALSE, dynamicconss, dynamicrows, FALSE) );
                }
-               else if( SCIPfindConshdlr(scip, "setppc") != NULL )
+               else if( hassetppc )
                {
                   /* if the constraint handler logicor does not exit but constraint
                    *  handler setppc create a setppc constraint */
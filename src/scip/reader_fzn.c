@@ -222,8 +222,6 @@ struct FznOutput
 };
 typedef struct FznOutput FZNOUTPUT;
 
-static const char delimchars[] = " \f\n\r\t\v";
-static const char tokenchars[] = ":<>=;{}[],()";
 static const char commentchars[] = "%";
 
 /*
@@ -280,7 +278,19 @@ SCIP_Bool isDelimChar(
    char                  c                   /**< input character */
    )
 {
-   return (c == '\0') || (strchr(delimchars, c) != NULL);
+   switch (c)
+   {
+   case ' ':
+   case '\f':
+   case '\n':
+   case '\r':
+   case '\t':
+   case '\v':
+   case '\0':
+      return TRUE;
+   default:
+      return FALSE;
+   }
 }
 
 /** returns whether the given character is a single token */
@@ -289,7 +299,24 @@ SCIP_Bool isTokenChar(
    char                  c                   /**< input character */
    )
 {
-   return (strchr(tokenchars, c) != NULL);
+   switch (c)
+   {
+   case ':':
+   case '<':
+   case '>':
+   case '=':
+   case ';':
+   case '{':
+   case '}':
+   case '[':
+   case ']':
+   case ',':
+   case '(':
+   case ')':
+      return TRUE;
+   default:
+      return FALSE;
+   }
 }
 
 /** check if the current token is equal to give char */
@@ -635,13 +662,12 @@ SCIP_Bool isValue(
    SCIP_Real*            value               /**< pointer to store the value (unchanged, if token is no value) */
    )
 {
-   double val;
+   SCIP_Real val;
    char* endptr;
 
    assert(value != NULL);
 
-   val = strtod(token, &endptr);
-   if( endptr != token && *endptr == '\0' )
+   if( SCIPstrToRealValue(token, &val, &endptr) && *endptr == '\0' )
    {
       *value = val;
       return TRUE;
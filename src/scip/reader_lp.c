@@ -746,11 +746,10 @@ SCIP_Bool isValue(
    }
    else
    {
-      double val;
+      SCIP_Real val;
       char* endptr;
 
-      val = strtod(lpinput->token, &endptr);
-      if( endptr != lpinput->token && *endptr == '\0' )
+      if( SCIPstrToRealValue(lpinput->token, &val, &endptr) && *endptr == '\0' )
       {
          *value = val;
          return TRUE;
@@ -175,6 +175,18 @@ struct OpbInput
 #if GENCONSNAMES == TRUE
    int                   consnumber;
 #endif
+   SCIP_VAR**            linvars;            /**< linear variables of the current line */
+   SCIP_Real*            lincoefs;           /**< linear coefficients of the current line */
+   int                   lincoefssize;       /**< size of linvars and lincoefs arrays */
+   SCIP_VAR**            termvars;           /**< variables of all nonlinear terms of the current line, term after term */
+   int                   termvarssize;       /**< size of termvars array */
+   SCIP_VAR***           terms;              /**< pointers into termvars to the first variable of each nonlinear term */
+   SCIP_Real*            termcoefs;          /**< coefficients of the nonlinear terms of the current line */
+   int*                  ntermvars;          /**< number of variables in each nonlinear term */
+   int                   termcoefssize;      /**< size of terms, termcoefs, and ntermvars arrays */
+   SCIP_Bool             initialconss;       /**< should model constraints be marked as initial? */
+   SCIP_Bool             dynamicrows;        /**< should rows be added and removed dynamically to the LP? */
+   SCIP_Bool             dynamiccols;        /**< should columns be added and removed dynamically to the LP? */
 };
 
 typedef struct OpbInput OPBINPUT;
@@ -573,11 +585,10 @@ SCIP_Bool isValue(
    }
    else
    {
-      double val;
+      SCIP_Real val;
       char* endptr;
 
-      val = strtod(opbinput->token, &endptr);
-      if( endptr != opbinput->token && *endptr == '\0' )
+      if( SCIPstrToRealValue(opbinput->token, &val, &endptr) && *endptr == '\0' )
       {
          *value = val;
          if( strlen(opbinput->token) > 18 )
@@ -656,18 +667,19 @@ SCIP_Bool isEndingSoftConstraintWeight(
 static
 SCIP_RETCODE createVariable(
    SCIP*                 scip,               /**< SCIP data structure */
+   OPBINPUT*             opbinput,           /**< OPB reading data */
    SCIP_VAR**            var,                /**< pointer to store the variable */
    char*                 name                /**< name for the variable */
    )
 {
    SCIP_VAR* newvar;
-   SCIP_Bool dynamiccols;
    SCIP_Bool initial;
    SCIP_Bool removable;
 
-   SCIP_CALL( SCIPgetBoolParam(scip, "reading/dynamiccols", &dynamiccols) );
-   initial = !dynamiccols;
-   removable = dynamiccols;
+   assert(opbinput != NULL);
+
+   initial = !opbinput->dynamiccols;
+   removable = opbinput->dynamiccols;
 
    /* create new variable of the given name */
    SCIPdebugMsg(scip, "creating new variable: <%s>\n", name);
@@ -724,7 +736,7 @@ SCIP_RETCODE getVariableOrTerm(
       var = SCIPfindVar(scip, name);
       if( var == NULL )
       {
-         SCIP_CALL( createVariable(scip, &var, name) );
+         SCIP_CALL( createVariable(scip, opbinput, &var, name) );
       }
 
       if( negated )
@@ -760,21 +772,24 @@ SCIP_RETCODE getVariableOrTerm(
    return SCIP_OKAY;
 }
 
-/** reads an objective or constraint with name and coefficients */
+/** reads an objective or constraint with name and coefficients
+ *
+ *  The coefficients are stored in the arrays of the OPB reading data, which are reused for all lines, such that reading
+ *  a line does not allocate memory unless it is longer than all previous lines. The returned arrays are only valid until
+ *  the next line is read.
+ */
 static
 SCIP_RETCODE readCoefficients(
    SCIP*const            scip,               /**< SCIP data structure */
    OPBINPUT*const        opbinput,           /**< OPB reading data */
    char*const            name,               /**< pointer to store the name of the line; must be at least of size
                                               *   OPB_MAX_LINELEN */
-   SCIP_VAR***           linvars,            /**< pointer to store the array with linear variables (must be freed by caller) */
-   SCIP_Real**           lincoefs,           /**< pointer to store the array with linear coefficients (must be freed by caller) */
+   SCIP_VAR***           linvars,            /**< pointer to store the array with linear variables */
+   SCIP_Real**           lincoefs,           /**< pointer to store the array with linear coefficients */
    int*const             nlincoefs,          /**< pointer to store the number of linear coefficients */
-   int*                  lincoefssize,       /**< pointer to store the size of linvars/lincoefs arrays */
-   SCIP_VAR****          terms,              /**< pointer to store the array with nonlinear variables (must be freed by caller) */
-   SCIP_Real**           termcoefs,          /**< pointer to store the array with nonlinear coefficients (must be freed by caller) */
-   int**                 ntermvars,          /**< pointer to store the number of nonlinear variables in the terms (must be freed by caller) */
-   int*                  termcoefssize,      /**< pointer to store the size of terms/termcoefs */
+   SCIP_VAR****          terms,              /**< pointer to store the array with nonlinear variables */
+   SCIP_Real**           termcoefs,          /**< pointer to store the array with nonlinear coefficients */
+   int**                 ntermvars,          /**< pointer to store the number of nonlinear variables in the terms */
    int*const             ntermcoefs,         /**< pointer to store the number of nonlinear coefficients */
    SCIP_Bool*const       newsection,         /**< pointer to store whether a new section was encountered */
    SCIP_Bool*const       isNonlinear,        /**< pointer to store if we have a nonlinear constraint */
@@ -793,27 +808,28 @@ SCIP_RETCODE readCoefficients(
    int tmpvarssize;
    int ntmpcoefs;
    int ntmpvars;
+   int ntermvarstotal;
+   int t;
 
    assert(opbinput != NULL);
    assert(name != NULL);
    assert(linvars != NULL);
    assert(lincoefs != NULL);
-   assert(lincoefssize != NULL);
    assert(nlincoefs != NULL);
    assert(terms != NULL);
    assert(termcoefs != NULL);
    assert(ntermvars != NULL);
-   assert(termcoefssize != NULL);
    assert(ntermcoefs != NULL);
    assert(newsection != NULL);
-
-   *linvars = NULL;
-   *lincoefs = NULL;
-   *lincoefssize = 0;
-   *terms = NULL;
-   *termcoefs = NULL;
-   *ntermvars = NULL;
-   *termcoefssize = 0;
+   assert(opbinput->lincoefssize > 0);
+   assert(opbinput->termcoefssize > 0);
+   assert(opbinput->termvarssize > 0);
+
+   *linvars = opbinput->linvars;
+   *lincoefs = opbinput->lincoefs;
+   *terms = opbinput->terms;
+   *termcoefs = opbinput->termcoefs;
+   *ntermvars = opbinput->ntermvars;
    *name = '\0';
    *nlincoefs = 0;
    *ntermcoefs = 0;
@@ -869,14 +885,8 @@ SCIP_RETCODE readCoefficients(
    }
 
    /* initialize buffers for storing the coefficients */
-   *lincoefssize = OPB_INIT_COEFSSIZE;
-   *termcoefssize = OPB_INIT_COEFSSIZE;
    tmpvarssize = OPB_INIT_COEFSSIZE;
-   SCIP_CALL( SCIPallocBlockMemoryArray(scip, linvars, *lincoefssize) );
-   SCIP_CALL( SCIPallocBlockMemoryArray(scip, lincoefs, *lincoefssize) );
-   SCIP_CALL( SCIPallocBlockMemoryArray(scip, terms, *termcoefssize) );
-   SCIP_CALL( SCIPallocBlockMemoryArray(scip, termcoefs, *termcoefssize) );
-   SCIP_CALL( SCIPallocBlockMemoryArray(scip, ntermvars, *termcoefssize) );
+   ntermvarstotal = 0;
 
    SCIP_CALL( SCIPallocBufferArray(scip, &tmpvars, tmpvarssize) );
    SCIP_CALL( SCIPallocBufferArray(scip, &tmpcoefs, tmpvarssize) );
@@ -1006,31 +1016,39 @@ SCIP_RETCODE readCoefficients(
 #endif
          if( !SCIPisZero(scip, coef) )
          {
-            assert(*ntermcoefs <= *termcoefssize);
+            assert(*ntermcoefs <= opbinput->termcoefssize);
             /* resize the terms, ntermvars, and termcoefs array if needed */
-            if( *ntermcoefs >= *termcoefssize )
+            if( *ntermcoefs >= opbinput->termcoefssize )
             {
                int newsize;
 
                newsize = SCIPcalcMemGrowSize(scip, *ntermcoefs + 1);
-               SCIP_CALL( SCIPreallocBlockMemoryArray(scip, terms, *termcoefssize, newsize) );
-               SCIP_CALL( SCIPreallocBlockMemoryArray(scip, termcoefs, *termcoefssize, newsize) );
-               SCIP_CALL( SCIPreallocBlockMemoryArray(scip, ntermvars, *termcoefssize, newsize) );
-               *termcoefssize = newsize;
+               SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &opbinput->terms, opbinput->termcoefssize, newsize) );
+               SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &opbinput->termcoefs, opbinput->termcoefssize, newsize) );
+               SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &opbinput->ntermvars, opbinput->termcoefssize, newsize) );
+               opbinput->termcoefssize = newsize;
+               *terms = opbinput->terms;
+               *termcoefs = opbinput->termcoefs;
+               *ntermvars = opbinput->ntermvars;
             }
-            assert(*ntermcoefs < *termcoefssize);
+            assert(*ntermcoefs < opbinput->termcoefssize);
 
-            /* get memory for the last term */
-            SCIP_CALL( SCIPallocBlockMemoryArray(scip, &((*terms)[*ntermcoefs]), ntmpvars) ); /*lint !e866 */
+            /* resize the array of term variables if needed; the term pointers are set after reading the line */
+            if( ntermvarstotal + ntmpvars > opbinput->termvarssize )
+            {
+               int newsize;
+
+               newsize = SCIPcalcMemGrowSize(scip, ntermvarstotal + ntmpvars);
+               SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &opbinput->termvars, opbinput->termvarssize, newsize) );
+               opbinput->termvarssize = newsize;
+            }
 
             /* set the number of variable in this term */
             (*ntermvars)[*ntermcoefs] = ntmpvars;
 
             /* add all variables */
-            for( --ntmpvars; ntmpvars >= 0; --ntmpvars )
-            {
-               (*terms)[*ntermcoefs][ntmpvars] = tmpvars[ntmpvars];
-            }
+            BMScopyMemoryArray(&opbinput->termvars[ntermvarstotal], tmpvars, ntmpvars);
+            ntermvarstotal += ntmpvars;
             /* add coefficient */
             (*termcoefs)[*ntermcoefs] = coefsign * coef;
 
@@ -1057,18 +1075,20 @@ SCIP_RETCODE readCoefficients(
          SCIPdebugMsg(scip, "(line %d) found linear term: %+g<%s>\n", opbinput->linenumber, coefsign * coef, SCIPvarGetName(tmpvars[0]));
          if( !SCIPisZero(scip, coef) )
          {
-            assert(*nlincoefs <= *lincoefssize);
+            assert(*nlincoefs <= opbinput->lincoefssize);
             /* resize the vars and coefs array if needed */
-            if( *nlincoefs >= *lincoefssize )
+            if( *nlincoefs >= opbinput->lincoefssize )
             {
                int newsize;
 
                newsize = SCIPcalcMemGrowSize(scip, *nlincoefs + 1);
-               SCIP_CALL( SCIPreallocBlockMemoryArray(scip, linvars, *lincoefssize, newsize) );
-               SCIP_CALL( SCIPreallocBlockMemoryArray(scip, lincoefs, *lincoefssize, newsize) );
-               *lincoefssize = newsize;
+               SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &opbinput->linvars, opbinput->lincoefssize, newsize) );
+               SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &opbinput->lincoefs, opbinput->lincoefssize, newsize) );
+               opbinput->lincoefssize = newsize;
+               *linvars = opbinput->linvars;
+               *lincoefs = opbinput->lincoefs;
             }
-            assert(*nlincoefs < *lincoefssize);
+            assert(*nlincoefs < opbinput->lincoefssize);
 
             /* add coefficient */
             (*linvars)[*nlincoefs] = tmpvars[0];
@@ -1093,6 +1113,14 @@ SCIP_RETCODE readCoefficients(
    }
 
  TERMINATE:
+   /* let the terms point to their variables, which are not moved anymore */
+   ntermvarstotal = 0;
+   for( t = 0; t < *ntermcoefs; ++t )
+   {
+      (*terms)[t] = &opbinput->termvars[ntermvarstotal];
+      ntermvarstotal += (*ntermvars)[t];
+   }
+
    if( !opbinput->haserror )
    {
       /* all variables should be in the right arrays */
@@ -1256,12 +1284,10 @@ SCIP_RETCODE readConstraints(
    SCIP_CONS* cons;
    SCIP_VAR** linvars;
    SCIP_Real* lincoefs;
-   int lincoefssize;
    int nlincoefs;
    SCIP_VAR*** terms;
    SCIP_Real* termcoefs;
    int* ntermvars;
-   int termcoefssize;
    int ntermcoefs;
    OPBSENSE sense;
    SCIP_RETCODE retcode;
@@ -1269,9 +1295,6 @@ SCIP_RETCODE readConstraints(
    SCIP_Real lhs;
    SCIP_Real rhs;
    SCIP_Bool newsection;
-   SCIP_Bool initialconss;
-   SCIP_Bool dynamicconss;
-   SCIP_Bool dynamicrows;
    SCIP_Bool initial;
    SCIP_Bool separate;
    SCIP_Bool enforce;
@@ -1287,7 +1310,6 @@ SCIP_RETCODE readConstraints(
    SCIP_Real weight;
    SCIP_VAR* indvar;
    char indname[SCIP_MAXSTRLEN];
-   int t;
 
    assert(scip != NULL);
    assert(opbinput != NULL);
@@ -1297,7 +1319,7 @@ SCIP_RETCODE readConstraints(
    retcode = SCIP_OKAY;
 
    /* read the objective coefficients */
-   SCIP_CALL( readCoefficients(scip, opbinput, name, &linvars, &lincoefs, &nlincoefs, &lincoefssize, &terms, &termcoefs, &ntermvars, &termcoefssize,
+   SCIP_CALL( readCoefficients(scip, opbinput, name, &linvars, &lincoefs, &nlincoefs, &terms, &termcoefs, &ntermvars,
          &ntermcoefs, &newsection, &isNonlinear, &issoftcons, &weight) );
 
    if( hasError(opbinput) || opbinput->eof )
@@ -1397,11 +1419,7 @@ SCIP_RETCODE readConstraints(
    }
 
    /* create and add the linear constraint */
-   SCIP_CALL( SCIPgetBoolParam(scip, "reading/initialconss", &initialconss) );
-   SCIP_CALL( SCIPgetBoolParam(scip, "reading/dynamicrows", &dynamicrows) );
-   SCIP_CALL( SCIPgetBoolParam(scip, "reading/" READER_NAME "/dynamicconss", &dynamicconss) );
-
-   initial = initialconss;
+   initial = opbinput->initialconss;
    separate = TRUE;
    enforce = TRUE;
    check = TRUE;
@@ -1409,14 +1427,14 @@ SCIP_RETCODE readConstraints(
    local = FALSE;
    modifiable = FALSE;
    dynamic = FALSE;/*dynamicconss;*/
-   removable = dynamicrows;
+   removable = opbinput->dynamicrows;
 
    /* create corresponding constraint */
    if( issoftcons )
    {
       (void) SCIPsnprintf(indname, SCIP_MAXSTRLEN, INDICATORVARNAME"%d", opbinput->nindvars);
       ++(opbinput->nindvars);
-      SCIP_CALL( createVariable(scip, &indvar, indname) );
+      SCIP_CALL( createVariable(scip, opbinput, &indvar, indname) );
 
       assert(!SCIPisInfinity(scip, -weight));
       SCIP_CALL( SCIPchgVarObj(scip, indvar, objscale * weight) );
@@ -1461,20 +1479,6 @@ SCIP_RETCODE readConstraints(
       ++(*nNonlinearConss);
 
  TERMINATE:
-
-   /* free memory */
-   for( t = ntermcoefs - 1; t >= 0; --t )
-   {
-      assert(terms != NULL);  /* for lint */
-      SCIPfreeBlockMemoryArray(scip, &(terms[t]), ntermvars[t]);
-   }
-
-   SCIPfreeBlockMemoryArrayNull(scip, &ntermvars, termcoefssize);
-   SCIPfreeBlockMemoryArrayNull(scip, &termcoefs, termcoefssize);
-   SCIPfreeBlockMemoryArrayNull(scip, &terms, termcoefssize);
-   SCIPfreeBlockMemoryArrayNull(scip, &lincoefs, lincoefssize);
-   SCIPfreeBlockMemoryArrayNull(scip, &linvars, lincoefssize);
-
    SCIP_CALL( retcode );
 
    return SCIP_OKAY;
@@ -3944,10 +3948,33 @@ SCIP_RETCODE SCIPreadOpb(
    opbinput.consnumber = 0;
 #endif
 
+   /* the coefficient arrays are shared by all lines of the file */
+   opbinput.lincoefssize = OPB_INIT_COEFSSIZE;
+   opbinput.termcoefssize = OPB_INIT_COEFSSIZE;
+   opbinput.termvarssize = OPB_INIT_COEFSSIZE;
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &opbinput.linvars, opbinput.lincoefssize) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &opbinput.lincoefs, opbinput.lincoefssize) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &opbinput.termvars, opbinput.termvarssize) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &opbinput.terms, opbinput.termcoefssize) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &opbinput.termcoefs, opbinput.termcoefssize) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &opbinput.ntermvars, opbinput.termcoefssize) );
+
+   /* get parameter values once instead of for every constraint and variable */
+   SCIP_CALL( SCIPgetBoolParam(scip, "reading/initialconss", &opbinput.initialconss) );
+   SCIP_CALL( SCIPgetBoolParam(scip, "reading/dynamicrows", &opbinput.dynamicrows) );
+   SCIP_CALL( SCIPgetBoolParam(scip, "reading/dynamiccols", &opbinput.dynamiccols) );
+
    /* read the file */
    retcode = readOPBFile(scip, &opbinput, filename);
 
    /* free dynamically allocated memory */
+   SCIPfreeBlockMemoryArray(scip, &opbinput.ntermvars, opbinput.termcoefssize);
+   SCIPfreeBlockMemoryArray(scip, &opbinput.termcoefs, opbinput.termcoefssize);
+   SCIPfreeBlockMemoryArray(scip, &opbinput.terms, opbinput.termcoefssize);
+   SCIPfreeBlockMemoryArray(scip, &opbinput.termvars, opbinput.termvarssize);
+   SCIPfreeBlockMemoryArray(scip, &opbinput.lincoefs, opbinput.lincoefssize);
+   SCIPfreeBlockMemoryArray(scip, &opbinput.linvars, opbinput.lincoefssize);
+
    for( i = OPB_MAX_PUSHEDTOKENS - 1; i >= 0; --i )
    {
       SCIPfreeBlockMemoryArray(scip, &(opbinput.pushedtokens[i]), OPB_MAX_LINELEN);
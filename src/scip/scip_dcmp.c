@@ -34,6 +34,7 @@
 #include "scip/struct_dcmp.h"
 #include "scip/debug.h"
 #include "scip/dcmp.h"
+#include "scip/hypergraph.h"
 #include "scip/mem.h"
 #include "scip/pub_misc.h"
 #include "scip/pub_var.h"
@@ -50,7 +51,10 @@
 #include "scip/scip_var.h"
 #include "scip/scip_datastructures.h"
 #include "scip/scip_message.h"
+#include "scip/scip_numerics.h"
+#include "scip/scip_randnumgen.h"
 #include "scip/pub_message.h"
+#include "scip/struct_set.h"
 
 
 #define LABEL_UNASSIGNED INT_MIN /* label constraints or variables as unassigned. Only for internal use */
@@ -1349,3 +1353,938 @@ SCIP_RETCODE SCIPcomputeDecompStats(
 
    return SCIP_OKAY;
 }
+
+/*
+ * automatic detection of decompositions by multilevel hypergraph partitioning
+ */
+
+#define DETECT_COARSENINGLIMIT      20       /**< coarsening stops at this many vertices per block */
+#define DETECT_MINCOARSENINGRATIO  0.9       /**< coarsening stops if a level shrinks the vertices by less than this ratio */
+#define DETECT_MAXLEVELS            30       /**< maximum number of coarsening levels */
+#define DETECT_MAXRATINGEDGESIZE  1000       /**< edges larger than this are ignored when rating vertex pairs for contraction */
+#define DETECT_REFINEROUNDS         10       /**< maximum number of refinement passes per level */
+#define DETECT_MAXBORDERFRAC       0.5       /**< maximum fraction of linking constraints of an accepted decomposition */
+#define DETECT_RANDSEED          20231       /**< initial random seed */
+
+/** one level of the multilevel hierarchy: a (coarsened) row-net hypergraph whose vertices are clusters of variables
+ *  and whose edges are the constraints
+ */
+struct DetectLevel
+{
+   SCIP_HYPERGRAPH*      hypergraph;         /**< hypergraph of this level */
+   int*                  weights;            /**< number of original variables contracted into each vertex */
+   int*                  coarsemap;          /**< vertex of the next coarser level for each vertex, or NULL on the coarsest level */
+   int                   nvertices;          /**< number of vertices */
+};
+typedef struct DetectLevel DETECTLEVEL;
+
+/** creates the finest level of the hierarchy with one vertex per problem variable and one edge per constraint */
+static
+SCIP_RETCODE detectCreateFinestLevel(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_DECOMP*          decomp,             /**< decomposition data structure, to determine the problem space */
+   DETECTLEVEL*          level,              /**< level to initialize */
+   SCIP_Bool*            varinconss,         /**< array to store for each variable whether it appears in a constraint */
+   SCIP_Bool*            success             /**< pointer to store whether all constraints provided their variables */
+   )
+{
+   SCIP_VAR** vars;
+   SCIP_CONS** conss;
+   SCIP_VAR** varbuf;
+   SCIP_HYPERGRAPH_VERTEX* pins;
+   int* lastedge;
+   int varbufsize;
+   int nvars;
+   int nconss;
+   int c;
+   int v;
+
+   assert(scip != NULL);
+   assert(decomp != NULL);
+   assert(level != NULL);
+   assert(varinconss != NULL);
+   assert(success != NULL);
+
+   getDecompVarsConssData(scip, decomp, &vars, &conss, &nvars, &nconss);
+
+   *success = TRUE;
+   varbufsize = getVarbufSize(scip);
+
+   /* the hypergraph does not support empty data slots, so we use the smallest ones */
+   SCIP_CALL( SCIPhypergraphCreate(&level->hypergraph, SCIPblkmem(scip), nvars, nconss, 1, 4, sizeof(size_t),
+         sizeof(size_t), sizeof(size_t)) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &level->weights, nvars) );
+   level->coarsemap = NULL;
+   level->nvertices = nvars;
+
+   for( v = 0; v < nvars; ++v )
+   {
+      SCIP_HYPERGRAPH_VERTEX vertex;
+
+      SCIP_CALL( SCIPhypergraphAddVertex(level->hypergraph, &vertex, NULL) );
+      assert(vertex == v);
+      level->weights[v] = 1;
+   }
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &varbuf, varbufsize) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &pins, varbufsize) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &lastedge, nvars) );
+   for( v = 0; v < nvars; ++v )
+   {
+      lastedge[v] = -1;
+      varinconss[v] = FALSE;
+   }
+
+   for( c = 0; c < nconss && *success; ++c )
+   {
+      SCIP_HYPERGRAPH_EDGE edge;
+      int nconsvars;
+      int requiredsize;
+      int npins;
+
+      SCIP_CALL( decompGetConsVarsAndLabels(scip, decomp, conss[c], varbuf, NULL, varbufsize, &nconsvars,
+            &requiredsize, success) );
+      if( ! *success )
+         break;
+
+      /* collect the distinct variables of this constraint; negations are already resolved */
+      npins = 0;
+      for( v = 0; v < nconsvars; ++v )
+      {
+         int idx = SCIPvarGetProbindex(varbuf[v]);
+
+         if( idx < 0 || idx >= nvars || lastedge[idx] == c )
+            continue;
+
+         lastedge[idx] = c;
+         varinconss[idx] = TRUE;
+         pins[npins++] = idx;
+      }
+
+      /* constraints with a single variable can never be linking and do not influence the partition; their variable
+       * is assigned to a block after partitioning
+       */
+      if( npins >= 2 )
+      {
+         SCIP_CALL( SCIPhypergraphAddEdge(level->hypergraph, npins, pins, &edge, NULL) );
+      }
+   }
+
+   SCIPfreeBufferArray(scip, &lastedge);
+   SCIPfreeBufferArray(scip, &pins);
+   SCIPfreeBufferArray(scip, &varbuf);
+
+   SCIP_CALL( SCIPhypergraphComputeVerticesEdges(level->hypergraph) );
+
+   return SCIP_OKAY;
+}
+
+/** frees the data of a level */
+static
+SCIP_RETCODE detectFreeLevel(
+   SCIP*                 scip,               /**< SCIP data structure */
+   DETECTLEVEL*          level               /**< level to free */
+   )
+{
+   assert(level != NULL);
+
+   SCIPfreeBlockMemoryArrayNull(scip, &level->coarsemap, level->nvertices);
+   SCIPfreeBlockMemoryArray(scip, &level->weights, level->nvertices);
+   SCIP_CALL( SCIPhypergraphFree(&level->hypergraph) );
+
+   return SCIP_OKAY;
+}
+
+/** coarsens a level by contracting pairs of vertices with a heavy-edge rating and creates the next coarser level */
+static
+SCIP_RETCODE detectCoarsenLevel(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_RANDNUMGEN*      randnumgen,         /**< random number generator */
+   DETECTLEVEL*          fine,               /**< level to coarsen */
+   DETECTLEVEL*          coarse,             /**< coarse level to create */
+   int                   maxweight           /**< maximum weight of a contracted vertex */
+   )
+{
+   SCIP_HYPERGRAPH* hypergraph;
+   SCIP_HYPERGRAPH_VERTEX* pins;
+   SCIP_Real* ratings;
+   int* touched;
+   int* order;
+   int* lastedge;
+   int nvertices;
+   int nedges;
+   int ncoarse;
+   int e;
+   int i;
+
+   assert(fine != NULL);
+   assert(coarse != NULL);
+   assert(fine->coarsemap == NULL);
+
+   hypergraph = fine->hypergraph;
+   nvertices = fine->nvertices;
+   nedges = SCIPhypergraphGetNEdges(hypergraph);
+
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &fine->coarsemap, nvertices) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &ratings, nvertices) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &touched, nvertices) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &order, nvertices) );
+
+   for( i = 0; i < nvertices; ++i )
+   {
+      fine->coarsemap[i] = -1;
+      ratings[i] = 0.0;
+      order[i] = i;
+   }
+   SCIPrandomPermuteIntArray(randnumgen, order, 0, nvertices);
+
+   /* match every vertex with its unmatched neighbor of highest rating sum_{e} 1 / (|e| - 1) */
+   ncoarse = 0;
+   for( i = 0; i < nvertices; ++i )
+   {
+      int vertex = order[i];
+      int ntouched = 0;
+      int best = -1;
+      SCIP_Real bestrating = 0.0;
+      int beyond;
+      int k;
+
+      if( fine->coarsemap[vertex] >= 0 )
+         continue;
+
+      beyond = SCIPhypergraphVertexEdgesBeyond(hypergraph, vertex);
+      for( k = SCIPhypergraphVertexEdgesFirst(hypergraph, vertex); k < beyond; ++k )
+      {
+         SCIP_HYPERGRAPH_VERTEX* edgevertices;
+         SCIP_Real rating;
+         int edge;
+         int size;
+         int j;
+
+         edge = SCIPhypergraphVertexEdgesGetAtIndex(hypergraph, k);
+         size = SCIPhypergraphEdgeSize(hypergraph, edge);
+         if( size > DETECT_MAXRATINGEDGESIZE )
+            continue;
+
+         rating = 1.0 / (size - 1.0);
+         edgevertices = SCIPhypergraphEdgeVertices(hypergraph, edge);
+         for( j = 0; j < size; ++j )
+         {
+            int neighbor = edgevertices[j];
+
+            if( neighbor == vertex || fine->coarsemap[neighbor] >= 0
+               || fine->weights[vertex] + fine->weights[neighbor] > maxweight )
+               continue;
+
+            if( ratings[neighbor] == 0.0 )
+               touched[ntouched++] = neighbor;
+            ratings[neighbor] += rating;
+         }
+      }
+
+      for( k = 0; k < ntouched; ++k )
+      {
+         int neighbor = touched[k];
+
+         /* prefer light neighbors to keep the vertex weights balanced */
+         if( ratings[neighbor] > bestrating || (ratings[neighbor] == bestrating && best >= 0 /*lint !e777*/
+               && fine->weights[neighbor] < fine->weights[best]) )
+         {
+            bestrating = ratings[neighbor];
+            best = neighbor;
+         }
+         ratings[neighbor] = 0.0;
+      }
+
+      fine->coarsemap[vertex] = ncoarse;
+      if( best >= 0 )
+         fine->coarsemap[best] = ncoarse;
+      ++ncoarse;
+   }
+
+   SCIPfreeBufferArray(scip, &order);
+   SCIPfreeBufferArray(scip, &touched);
+   SCIPfreeBufferArray(scip, &ratings);
+
+   /* build the contracted hypergraph */
+   SCIP_CALL( SCIPhypergraphCreate(&coarse->hypergraph, SCIPblkmem(scip), ncoarse, nedges, 1, 4, sizeof(size_t),
+         sizeof(size_t), sizeof(size_t)) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &coarse->weights, ncoarse) );
+   coarse->coarsemap = NULL;
+   coarse->nvertices = ncoarse;
+
+   for( i = 0; i < ncoarse; ++i )
+   {
+      SCIP_HYPERGRAPH_VERTEX vertex;
+
+      SCIP_CALL( SCIPhypergraphAddVertex(coarse->hypergraph, &vertex, NULL) );
+      assert(vertex == i);
+      coarse->weights[i] = 0;
+   }
+   for( i = 0; i < nvertices; ++i )
+      coarse->weights[fine->coarsemap[i]] += fine->weights[i];
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &pins, ncoarse) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &lastedge, ncoarse) );
+   for( i = 0; i < ncoarse; ++i )
+      lastedge[i] = -1;
+
+   for( e = 0; e < nedges; ++e )
+   {
+      SCIP_HYPERGRAPH_VERTEX* edgevertices;
+      int size;
+      int npins = 0;
+
+      size = SCIPhypergraphEdgeSize(hypergraph, e);
+      edgevertices = SCIPhypergraphEdgeVertices(hypergraph, e);
+      for( i = 0; i < size; ++i )
+      {
+         int vertex = fine->coarsemap[edgevertices[i]];
+
+         if( lastedge[vertex] == e )
+            continue;
+
+         lastedge[vertex] = e;
+         pins[npins++] = vertex;
+      }
+
+      /* edges that are contracted into a single vertex can no longer be cut */
+      if( npins >= 2 )
+      {
+         SCIP_HYPERGRAPH_EDGE edge;
+
+         SCIP_CALL( SCIPhypergraphAddEdge(coarse->hypergraph, npins, pins, &edge, NULL) );
+      }
+   }
+
+   SCIPfreeBufferArray(scip, &lastedge);
+   SCIPfreeBufferArray(scip, &pins);
+
+   SCIP_CALL( SCIPhypergraphComputeVerticesEdges(coarse->hypergraph) );
+
+   return SCIP_OKAY;
+}
+
+/** computes an initial partition of the coarsest level by greedily growing one block after the other along the edges */
+static
+SCIP_RETCODE detectInitialPartition(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_RANDNUMGEN*      randnumgen,         /**< random number generator */
+   DETECTLEVEL*          level,              /**< coarsest level */
+   int                   nblocks,            /**< number of blocks */
+   int*                  part                /**< array to store the block of each vertex */
+   )
+{
+   SCIP_HYPERGRAPH* hypergraph;
+   SCIP_Bool* edgevisited;
+   int* order;
+   int* queue;
+   int nvertices;
+   int nedges;
+   int totalweight;
+   int assignedweight;
+   int nextseed;
+   int b;
+   int i;
+
+   assert(level != NULL);
+   assert(part != NULL);
+   assert(nblocks >= 2);
+
+   hypergraph = level->hypergraph;
+   nvertices = level->nvertices;
+   nedges = SCIPhypergraphGetNEdges(hypergraph);
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &order, nvertices) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &queue, nvertices) );
+   SCIP_CALL( SCIPallocClearBufferArray(scip, &edgevisited, MAX(nedges, 1)) );
+
+   totalweight = 0;
+   for( i = 0; i < nvertices; ++i )
+   {
+      part[i] = -1;
+      order[i] = i;
+      totalweight += level->weights[i];
+   }
+   SCIPrandomPermuteIntArray(randnumgen, order, 0, nvertices);
+
+   assignedweight = 0;
+   nextseed = 0;
+   for( b = 0; b < nblocks - 1; ++b )
+   {
+      int target;
+      int blockweight = 0;
+      int queuebegin = 0;
+      int queueend = 0;
+
+      /* aim at the average weight of the remaining blocks */
+      target = (totalweight - assignedweight) / (nblocks - b);
+
+      while( blockweight < target )
+      {
+         int vertex;
+         int beyond;
+         int k;
+
+         /* start a new region from a random unassigned vertex if the current region cannot grow anymore */
+         if( queuebegin == queueend )
+         {
+            while( nextseed < nvertices && part[order[nextseed]] >= 0 )
+               ++nextseed;
+            if( nextseed == nvertices )
+               break;
+            queue[queueend++] = order[nextseed];
+            part[order[nextseed]] = nblocks;
+         }
+
+         vertex = queue[queuebegin++];
+         part[vertex] = b;
+         blockweight += level->weights[vertex];
+
+         beyond = SCIPhypergraphVertexEdgesBeyond(hypergraph, vertex);
+         for( k = SCIPhypergraphVertexEdgesFirst(hypergraph, vertex); k < beyond; ++k )
+         {
+            SCIP_HYPERGRAPH_VERTEX* edgevertices;
+            int edge;
+            int size;
+            int j;
+
+            edge = SCIPhypergraphVertexEdgesGetAtIndex(hypergraph, k);
+            if( edgevisited[edge] )
+               continue;
+            edgevisited[edge] = TRUE;
+
+            size = SCIPhypergraphEdgeSize(hypergraph, edge);
+            edgevertices = SCIPhypergraphEdgeVertices(hypergraph, edge);
+            for( j = 0; j < size; ++j )
+            {
+               /* the value nblocks marks vertices that are queued but not yet assigned */
+               if( part[edgevertices[j]] == -1 )
+               {
+                  part[edgevertices[j]] = nblocks;
+                  queue[queueend++] = edgevertices[j];
+               }
+            }
+         }
+      }
+
+      /* release queued vertices that did not fit into the block */
+      for( i = queuebegin; i < queueend; ++i )
+      {
+         assert(part[queue[i]] == nblocks);
+         part[queue[i]] = -1;
+      }
+
+      /* edges are visited again from the next block */
+      for( i = 0; i < nedges; ++i )
+         edgevisited[i] = FALSE;
+
+      assignedweight += blockweight;
+   }
+
+   /* the last block takes all remaining vertices */
+   for( i = 0; i < nvertices; ++i )
+   {
+      if( part[i] == -1 )
+         part[i] = nblocks - 1;
+   }
+
+   SCIPfreeBufferArray(scip, &edgevisited);
+   SCIPfreeBufferArray(scip, &queue);
+   SCIPfreeBufferArray(scip, &order);
+
+   return SCIP_OKAY;
+}
+
+/** returns the position of a block in the list of blocks that an edge has pins in, or -1 if the edge has no pin in it */
+static
+int detectFindPinBlock(
+   int*                  pinblocks,          /**< blocks that the edge has pins in */
+   int                   nconnected,         /**< number of blocks that the edge has pins in */
+   int                   block               /**< block to look for */
+   )
+{
+   int j;
+
+   for( j = 0; j < nconnected; ++j )
+   {
+      if( pinblocks[j] == block )
+         return j;
+   }
+
+   return -1;
+}
+
+/** improves a partition by greedily moving single vertices between blocks such that fewer edges are cut, while
+ *  respecting the maximum block weight
+ *
+ *  For every edge, only the blocks that it has pins in are stored together with their pin counts, such that the memory
+ *  is linear in the number of pins instead of the number of edges times the number of blocks.
+ */
+static
+SCIP_RETCODE detectRefinePartition(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_RANDNUMGEN*      randnumgen,         /**< random number generator */
+   DETECTLEVEL*          level,              /**< level to refine */
+   int                   nblocks,            /**< number of blocks */
+   int                   maxblockweight,     /**< maximum weight of a block */
+   int*                  part                /**< block of each vertex, updated in place */
+   )
+{
+   SCIP_HYPERGRAPH* hypergraph;
+   int* pinstart;
+   int* pinblocks;
+   int* pincounts;
+   int* connectivity;
+   int* blockweights;
+   int* gains;
+   int* order;
+   int nvertices;
+   int nedges;
+   int round;
+   int e;
+   int i;
+
+   assert(level != NULL);
+   assert(part != NULL);
+
+   hypergraph = level->hypergraph;
+   nvertices = level->nvertices;
+   nedges = SCIPhypergraphGetNEdges(hypergraph);
+
+   if( nedges == 0 )
+      return SCIP_OKAY;
+
+   /* an edge has pins in at most as many blocks as it has vertices */
+   SCIP_CALL( SCIPallocBufferArray(scip, &pinstart, nedges + 1) );
+   pinstart[0] = 0;
+   for( e = 0; e < nedges; ++e )
+      pinstart[e + 1] = pinstart[e] + SCIPhypergraphEdgeSize(hypergraph, e);
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &pinblocks, pinstart[nedges]) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &pincounts, pinstart[nedges]) );
+   SCIP_CALL( SCIPallocClearBufferArray(scip, &connectivity, nedges) );
+   SCIP_CALL( SCIPallocClearBufferArray(scip, &blockweights, nblocks) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &gains, nblocks) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &order, nvertices) );
+
+   /* count for every edge its pins in every block and the number of blocks it connects */
+   for( e = 0; e < nedges; ++e )
+   {
+      SCIP_HYPERGRAPH_VERTEX* edgevertices;
+      int* blocks = &pinblocks[pinstart[e]];
+      int* counts = &pincounts[pinstart[e]];
+      int size;
+
+      size = SCIPhypergraphEdgeSize(hypergraph, e);
+      edgevertices = SCIPhypergraphEdgeVertices(hypergraph, e);
+      for( i = 0; i < size; ++i )
+      {
+         int pos;
+
+         pos = detectFindPinBlock(blocks, connectivity[e], part[edgevertices[i]]);
+         if( pos == -1 )
+         {
+            pos = connectivity[e]++;
+            blocks[pos] = part[edgevertices[i]];
+            counts[pos] = 0;
+         }
+         ++counts[pos];
+      }
+   }
+
+   for( i = 0; i < nvertices; ++i )
+   {
+      blockweights[part[i]] += level->weights[i];
+      order[i] = i;
+   }
+
+   for( round = 0; round < DETECT_REFINEROUNDS; ++round )
+   {
+      int nmoves = 0;
+
+      SCIPrandomPermuteIntArray(randnumgen, order, 0, nvertices);
+
+      for( i = 0; i < nvertices; ++i )
+      {
+         int vertex = order[i];
+         int from = part[vertex];
+         int weight = level->weights[vertex];
+         int bestgain;
+         int best;
+         int beyond;
+         int first;
+         int b;
+         int k;
+
+         first = SCIPhypergraphVertexEdgesFirst(hypergraph, vertex);
+         beyond = SCIPhypergraphVertexEdgesBeyond(hypergraph, vertex);
+         if( first == beyond )
+            continue;
+
+         /* gains[b] is the change in the number of cut edges if the vertex is moved to block b */
+         for( b = 0; b < nblocks; ++b )
+            gains[b] = 0;
+
+         for( k = first; k < beyond; ++k )
+         {
+            int* blocks;
+            int* counts;
+            int edge;
+            int pos;
+
+            edge = SCIPhypergraphVertexEdgesGetAtIndex(hypergraph, k);
+            blocks = &pinblocks[pinstart[edge]];
+            counts = &pincounts[pinstart[edge]];
+
+            if( connectivity[edge] == 1 )
+            {
+               /* an uncut edge becomes cut by any move */
+               for( b = 0; b < nblocks; ++b )
+                  --gains[b];
+            }
+            else if( connectivity[edge] == 2 )
+            {
+               pos = detectFindPinBlock(blocks, 2, from);
+               assert(pos >= 0);
+
+               /* the edge becomes uncut if the vertex joins the only other block */
+               if( counts[pos] == 1 )
+                  ++gains[blocks[1 - pos]];
+            }
+         }
+
+         best = -1;
+         bestgain = 0;
+         for( b = 0; b < nblocks; ++b )
+         {
+            if( b == from || blockweights[b] + weight > maxblockweight )
+               continue;
+
+            /* accept zero-gain moves only if they improve the balance */
+            if( gains[b] > bestgain || (gains[b] == 0 && bestgain == 0 && blockweights[b] + weight < blockweights[from]
+                  && (best == -1 || blockweights[b] < blockweights[best])) )
+            {
+               bestgain = gains[b];
+               best = b;
+            }
+         }
+
+         if( best == -1 )
+            continue;
+
+         /* move the vertex and update pin counts and connectivities */
+         for( k = first; k < beyond; ++k )
+         {
+            int* blocks;
+            int* counts;
+            int edge;
+            int pos;
+
+            edge = SCIPhypergraphVertexEdgesGetAtIndex(hypergraph, k);
+            blocks = &pinblocks[pinstart[edge]];
+            counts = &pincounts[pinstart[edge]];
+
+            /* remove the pin from its old block; a block without pins is replaced by the last block of the edge */
+            pos = detectFindPinBlock(blocks, connectivity[edge], from);
+            assert(pos >= 0);
+            if( --counts[pos] == 0 )
+            {
+               --connectivity[edge];
+               blocks[pos] = blocks[connectivity[edge]];
+               counts[pos] = counts[connectivity[edge]];
+            }
+
+            pos = detectFindPinBlock(blocks, connectivity[edge], best);
+            if( pos == -1 )
+            {
+               assert(connectivity[edge] < pinstart[edge + 1] - pinstart[edge]);
+               pos = connectivity[edge]++;
+               blocks[pos] = best;
+               counts[pos] = 0;
+            }
+            ++counts[pos];
+         }
+
+         blockweights[from] -= weight;
+         blockweights[best] += weight;
+         part[vertex] = best;
+         ++nmoves;
+      }
+
+      if( nmoves == 0 )
+         break;
+   }
+
+   SCIPfreeBufferArray(scip, &order);
+   SCIPfreeBufferArray(scip, &gains);
+   SCIPfreeBufferArray(scip, &blockweights);
+   SCIPfreeBufferArray(scip, &connectivity);
+   SCIPfreeBufferArray(scip, &pincounts);
+   SCIPfreeBufferArray(scip, &pinblocks);
+   SCIPfreeBufferArray(scip, &pinstart);
+
+   return SCIP_OKAY;
+}
+
+/** computes a decomposition into (at most) \p nblocks blocks by multilevel partitioning of the row-net hypergraph
+ *
+ *  The variables are the vertices and the constraints are the edges of the hypergraph. The variables are partitioned
+ *  into blocks of roughly equal size such that few constraints contain variables of different blocks. The variable
+ *  labels are set to the computed blocks, and the constraint labels are computed by SCIPcomputeDecompConsLabels(),
+ *  such that constraints spanning several blocks become linking constraints. If the decomposition uses Benders'
+ *  labels, the variable labels are recomputed by SCIPcomputeDecompVarsLabels() afterwards.
+ *
+ *  The partitioning coarsens the hypergraph by repeatedly contracting pairs of strongly connected vertices, computes
+ *  an initial partition of the coarsest hypergraph, and projects it back level by level while moving single vertices
+ *  between blocks to reduce the number of cut constraints.
+ */
+SCIP_RETCODE SCIPcomputeDecompPartition(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_DECOMP*          decomp,             /**< decomposition data structure */
+   int                   nblocks,            /**< number of blocks to compute */
+   SCIP_Real             imbalance,          /**< allowed relative deviation of the block sizes from the average */
+   unsigned int          seed,               /**< initial random seed, modified by the global seed shift */
+   SCIP_Bool*            success             /**< pointer to store whether a partition could be computed */
+   )
+{
+   SCIP_RANDNUMGEN* randnumgen;
+   SCIP_VAR** vars;
+   SCIP_CONS** conss;
+   DETECTLEVEL* levels;
+   SCIP_Bool* varinconss;
+   int* part;
+   int* coarsepart;
+   int* varlabels;
+   int* blocksizes;
+   int nlevels;
+   int nvars;
+   int nconss;
+   int maxblockweight;
+   int maxweight;
+   int l;
+   int i;
+
+   assert(scip != NULL);
+   assert(decomp != NULL);
+   assert(nblocks >= 2);
+   assert(imbalance >= 0.0);
+   assert(success != NULL);
+
+   *success = FALSE;
+
+   getDecompVarsConssData(scip, decomp, &vars, &conss, &nvars, &nconss);
+
+   if( nvars < nblocks || nconss == 0 )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &varinconss, nvars) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &levels, DETECT_MAXLEVELS) );
+
+   SCIP_CALL( detectCreateFinestLevel(scip, decomp, &levels[0], varinconss, success) );
+   nlevels = 1;
+
+   if( ! *success )
+   {
+      SCIPdebugMsg(scip, "constraint without access to its variables, skipping decomposition detection\n");
+      goto TERMINATE;
+   }
+
+   SCIP_CALL( SCIPcreateRandom(scip, &randnumgen, seed, TRUE) );
+
+   /* coarsening phase */
+   maxweight = MAX(1, nvars / (DETECT_COARSENINGLIMIT * nblocks));
+   while( nlevels < DETECT_MAXLEVELS && levels[nlevels - 1].nvertices > DETECT_COARSENINGLIMIT * nblocks )
+   {
+      SCIP_CALL( detectCoarsenLevel(scip, randnumgen, &levels[nlevels - 1], &levels[nlevels], maxweight) );
+      ++nlevels;
+
+      if( levels[nlevels - 1].nvertices > DETECT_MINCOARSENINGRATIO * levels[nlevels - 2].nvertices )
+         break;
+   }
+
+   SCIPdebugMsg(scip, "coarsened %d variables to %d vertices in %d levels\n", nvars, levels[nlevels - 1].nvertices,
+      nlevels);
+
+   /* initial partitioning and uncoarsening with refinement on every level */
+   maxblockweight = (int)((1.0 + imbalance) * SCIPceil(scip, (SCIP_Real)nvars / nblocks));
+   SCIP_CALL( SCIPallocBufferArray(scip, &part, nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &coarsepart, nvars) );
+
+   SCIP_CALL( detectInitialPartition(scip, randnumgen, &levels[nlevels - 1], nblocks, part) );
+   SCIP_CALL( detectRefinePartition(scip, randnumgen, &levels[nlevels - 1], nblocks, maxblockweight, part) );
+
+   for( l = nlevels - 2; l >= 0; --l )
+   {
+      /* project the partition from level l + 1 to level l */
+      BMScopyMemoryArray(coarsepart, part, levels[l + 1].nvertices);
+      for( i = 0; i < levels[l].nvertices; ++i )
+         part[i] = coarsepart[levels[l].coarsemap[i]];
+
+      SCIP_CALL( detectRefinePartition(scip, randnumgen, &levels[l], nblocks, maxblockweight, part) );
+   }
+
+   /* variables of at least one constraint with several variables keep their block */
+   SCIP_CALL( SCIPallocBufferArray(scip, &varlabels, nvars) );
+   SCIP_CALL( SCIPallocClearBufferArray(scip, &blocksizes, nblocks) );
+   for( i = 0; i < nvars; ++i )
+   {
+      if( SCIPhypergraphVertexEdgesFirst(levels[0].hypergraph, i) == SCIPhypergraphVertexEdgesBeyond(levels[0].hypergraph, i) )
+         varlabels[i] = SCIP_DECOMP_LINKVAR;
+      else
+      {
+         varlabels[i] = part[i];
+         ++blocksizes[part[i]];
+      }
+   }
+
+   /* variables that only appear in single-variable constraints are added to the currently smallest block, such that
+    * their constraints are not linking; variables that do not appear in any constraint are not assigned to any block
+    */
+   for( i = 0; i < nvars; ++i )
+   {
+      int minblock;
+      int b;
+
+      if( varlabels[i] != SCIP_DECOMP_LINKVAR || ! varinconss[i] )
+         continue;
+
+      minblock = 0;
+      for( b = 1; b < nblocks; ++b )
+      {
+         if( blocksizes[b] < blocksizes[minblock] )
+            minblock = b;
+      }
+
+      varlabels[i] = minblock;
+      ++blocksizes[minblock];
+   }
+   SCIPfreeBufferArray(scip, &blocksizes);
+
+   SCIP_CALL( SCIPdecompClear(decomp, TRUE, TRUE) );
+   SCIP_CALL( SCIPdecompSetVarsLabels(decomp, vars, varlabels, nvars) );
+
+   /* derive constraint labels by the Dantzig-Wolfe rule, which tolerates constraints spanning several blocks */
+   if( SCIPdecompUseBendersLabels(decomp) )
+   {
+      SCIPdecompSetUseBendersLabels(decomp, FALSE);
+      SCIP_CALL( SCIPcomputeDecompConsLabels(scip, decomp, conss, nconss) );
+      SCIPdecompSetUseBendersLabels(decomp, TRUE);
+      SCIP_CALL( SCIPcomputeDecompVarsLabels(scip, decomp, conss, nconss) );
+   }
+   else
+   {
+      SCIP_CALL( SCIPcomputeDecompConsLabels(scip, decomp, conss, nconss) );
+   }
+
+   SCIPfreeBufferArray(scip, &varlabels);
+   SCIPfreeBufferArray(scip, &coarsepart);
+   SCIPfreeBufferArray(scip, &part);
+   SCIPfreeRandom(scip, &randnumgen);
+
+TERMINATE:
+   for( l = nlevels - 1; l >= 0; --l )
+   {
+      SCIP_CALL( detectFreeLevel(scip, &levels[l]) );
+   }
+   SCIPfreeBlockMemoryArray(scip, &levels, DETECT_MAXLEVELS);
+   SCIPfreeBufferArray(scip, &varinconss);
+
+   return SCIP_OKAY;
+}
+
+/** detects a decomposition of the original or transformed problem automatically and adds it to SCIP
+ *
+ *  Decompositions with 2, 4, 8, ... and decomposition/detectmaxblocks blocks are computed by
+ *  SCIPcomputeDecompPartition(). The one of highest modularity is added to the decomposition storage, unless more than
+ *  half of its constraints are linking.
+ */
+SCIP_RETCODE SCIPdetectDecomp(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_Bool             original,           /**< should the decomposition be computed for the original problem? */
+   SCIP_Bool*            success             /**< pointer to store whether a decomposition was added, or NULL */
+   )
+{
+   SCIP_DECOMP* bestdecomp;
+   SCIP_Real bestmodularity;
+   SCIP_Real imbalance;
+   SCIP_Bool benderslabels;
+   int maxblocks;
+   int nconss;
+   int nblocks;
+
+   assert(scip != NULL);
+
+   SCIP_CALL( SCIPcheckStage(scip, "SCIPdetectDecomp", FALSE, original, original, original, original, TRUE, TRUE, TRUE,
+         !original, !original, FALSE, FALSE, FALSE, FALSE) );
+
+   if( success != NULL )
+      *success = FALSE;
+
+   maxblocks = scip->set->decomp_detectmaxblocks;
+   imbalance = scip->set->decomp_detectimbalance;
+   benderslabels = scip->set->decomp_benderslabels;
+   nconss = original ? SCIPgetNOrigConss(scip) : SCIPgetNConss(scip);
+
+   bestdecomp = NULL;
+   bestmodularity = -SCIPinfinity(scip);
+
+   nblocks = 2;
+   while( nblocks <= maxblocks )
+   {
+      SCIP_DECOMP* decomp;
+      SCIP_Bool partitioned;
+      SCIP_Real modularity;
+
+      SCIP_CALL( SCIPcreateDecomp(scip, &decomp, nblocks, original, benderslabels) );
+      SCIP_CALL( SCIPcomputeDecompPartition(scip, decomp, nblocks, imbalance, DETECT_RANDSEED, &partitioned) );
+
+      if( ! partitioned )
+      {
+         SCIPfreeDecomp(scip, &decomp);
+         break;
+      }
+
+      SCIP_CALL( SCIPcomputeDecompStats(scip, decomp, TRUE) );
+
+      /* compare by the number of linking constraints if the expensive measures are disabled */
+      if( scip->set->decomp_disablemeasures )
+         modularity = -(SCIP_Real)SCIPdecompGetNBorderConss(decomp);
+      else
+         modularity = SCIPdecompGetModularity(decomp);
+
+      SCIPdebugMsg(scip, "detected decomposition with %d blocks, %d linking constraints, modularity %g\n",
+         SCIPdecompGetNBlocks(decomp), SCIPdecompGetNBorderConss(decomp), modularity);
+
+      if( SCIPdecompGetNBlocks(decomp) >= 2 && SCIPdecompGetNBorderConss(decomp) <= DETECT_MAXBORDERFRAC * nconss
+         && modularity > bestmodularity )
+      {
+         if( bestdecomp != NULL )
+            SCIPfreeDecomp(scip, &bestdecomp);
+         bestdecomp = decomp;
+         bestmodularity = modularity;
+      }
+      else
+         SCIPfreeDecomp(scip, &decomp);
+
+      /* double the number of blocks, but always try the maximum number of blocks last */
+      if( nblocks < maxblocks && 2 * nblocks > maxblocks )
+         nblocks = maxblocks;
+      else
+         nblocks *= 2;
+   }
+
+   if( bestdecomp == NULL )
+      return SCIP_OKAY;
+
+   SCIPverbMessage(scip, SCIP_VERBLEVEL_HIGH, NULL, "detected decomposition with %d blocks and %d linking constraints\n",
+      SCIPdecompGetNBlocks(bestdecomp), SCIPdecompGetNBorderConss(bestdecomp));
+
+   /* the decomposition store takes ownership of the decomposition */
+   SCIP_CALL( SCIPaddDecomp(scip, bestdecomp) );
+
+   if( success != NULL )
+      *success = TRUE;
+
+   return SCIP_OKAY;
+}
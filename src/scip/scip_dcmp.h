@@ -160,6 +160,37 @@ SCIP_RETCODE SCIPcomputeDecompStats(
    SCIP_Bool             uselimits           /**< respect user limits on potentially expensive graph statistics? */
    );
 
+/** computes a decomposition into (at most) \p nblocks blocks by multilevel partitioning of the row-net hypergraph
+ *
+ *  The variables are the vertices and the constraints are the edges of the hypergraph. The variables are partitioned
+ *  into blocks of roughly equal size such that few constraints contain variables of different blocks. The variable
+ *  labels are set to the computed blocks, and the constraint labels are computed by SCIPcomputeDecompConsLabels(),
+ *  such that constraints spanning several blocks become linking constraints. If the decomposition uses Benders'
+ *  labels, the variable labels are recomputed by SCIPcomputeDecompVarsLabels() afterwards.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPcomputeDecompPartition(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_DECOMP*          decomp,             /**< decomposition data structure */
+   int                   nblocks,            /**< number of blocks to compute */
+   SCIP_Real             imbalance,          /**< allowed relative deviation of the block sizes from the average */
+   unsigned int          seed,               /**< initial random seed, modified by the global seed shift */
+   SCIP_Bool*            success             /**< pointer to store whether a partition could be computed */
+   );
+
+/** detects a decomposition of the original or transformed problem automatically and adds it to SCIP
+ *
+ *  Decompositions with 2, 4, 8, ... and decomposition/detectmaxblocks blocks are computed by
+ *  SCIPcomputeDecompPartition(). The one of highest modularity is added to the decomposition storage, unless more than
+ *  half of its constraints are linking.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPdetectDecomp(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_Bool             original,           /**< should the decomposition be computed for the original problem? */
+   SCIP_Bool*            success             /**< pointer to store whether a decomposition was added, or NULL */
+   );
+
 /** @} */
 
 #ifdef __cplusplus
@@ -51,6 +51,7 @@
 #include "scip/dcmp.h"
 #include "scip/debug.h"
 #include "scip/lp.h"
+#include "scip/message.h"
 #include "scip/pricer.h"
 #include "scip/pricestore.h"
 #include "scip/primal.h"
@@ -94,6 +95,8 @@
 #include <stdio.h>
 #include <string.h>
 
+#define WRITEBUFFERSIZE (1 << 20) /**< size of the stream buffer used for writing problem files */
+
 /** creates empty problem and initializes all solving data structures (the objective sense is set to MINIMIZE)
  *  If the problem type requires the use of variable pricers, these pricers should be added to the problem with calls
  *  to SCIPactivatePricer(). These pricers are automatically deactivated, when the problem is freed.
@@ -500,6 +503,7 @@ SCIP_RETCODE writeProblem(
    char* tmpfilename;
    char* fileextension;
    char* compression;
+   char* filebuffer;
    FILE* file;
 
    assert(scip != NULL );
@@ -508,6 +512,7 @@ SCIP_RETCODE writeProblem(
    compression = NULL;
    file = NULL;
    tmpfilename = NULL;
+   filebuffer = NULL;
 
    if( filename != NULL &&  filename[0] != '\0' )
    {
@@ -521,11 +526,22 @@ SCIP_RETCODE writeProblem(
          return SCIP_FILECREATEERROR;
       }
 
+      /* the writers produce their output in many small pieces; a large stream buffer reduces the number of system calls
+       * for large problems, since the default message handler does not flush the file after each of them; if the buffer
+       * cannot be allocated, we keep the default buffer of the stream
+       */
+      if( BMSallocMemoryArray(&filebuffer, WRITEBUFFERSIZE) != NULL )
+      {
+         if( setvbuf(file, filebuffer, _IOFBF, (size_t)WRITEBUFFERSIZE) != 0 )
+            BMSfreeMemoryArray(&filebuffer);
+      }
+
       /* get extension from filename,
        * if an error occurred, close the file before returning */
       if( BMSduplicateMemoryArray(&tmpfilename, filename, strlen(filename)+1) == NULL )
       {
          (void) fclose(file);
+         BMSfreeMemoryArrayNull(&filebuffer);
          SCIPerrorMessage("Error <%d> in function call\n", SCIP_NOMEMORY);
          return SCIP_NOMEMORY;
       }
@@ -537,6 +553,7 @@ SCIP_RETCODE writeProblem(
          SCIPmessagePrintWarning(scip->messagehdlr, "currently it is not possible to write files with any compression\n");
          BMSfreeMemoryArray(&tmpfilename);
          (void) fclose(file);
+         BMSfreeMemoryArrayNull(&filebuffer);
          return SCIP_FILECREATEERROR;
       }
 
@@ -545,14 +562,19 @@ SCIP_RETCODE writeProblem(
          SCIPmessagePrintWarning(scip->messagehdlr, "filename <%s> has no file extension, select default <cip> format for writing\n", filename);
       }
 
+      SCIPmessagehdlrSetUnflushedFile(scip->messagehdlr, file);
+
       if( transformed )
          retcode = SCIPprintTransProblem(scip, file, extension != NULL ? extension : fileextension, genericnames);
       else
          retcode = SCIPprintOrigProblem(scip, file, extension != NULL ? extension : fileextension, genericnames);
 
+      SCIPmessagehdlrSetUnflushedFile(scip->messagehdlr, NULL);
+
       BMSfreeMemoryArray(&tmpfilename);
 
       success = fclose(file);
+      BMSfreeMemoryArrayNull(&filebuffer);
       if( success != 0 )
       {
          SCIPerrorMessage("An error occurred while closing file <%s>\n", filename);
@@ -461,6 +461,23 @@ void SCIPupdateDivesetStats(
    SCIP_DIVECONTEXT      divecontext         /**< context for diving statistics */
    );
 
+/** update diveset statistics and global diveset statistics for a dive that did not take place in the probing mode of
+ *  this SCIP instance, e.g., a dive in a sub-SCIP, such that the depth reached by the dive is given explicitly
+ */
+SCIP_EXPORT
+void SCIPupdateDivesetStatsDepth(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_DIVESET*         diveset,            /**< diveset to be reset */
+   int                   depth,              /**< the depth reached by the dive */
+   int                   nprobingnodes,      /**< the number of probing nodes explored this time */
+   int                   nbacktracks,        /**< the number of backtracks during probing this time */
+   SCIP_Longint          nsolsfound,         /**< the number of solutions found */
+   SCIP_Longint          nbestsolsfound,     /**< the number of best solutions found */
+   SCIP_Longint          nconflictsfound,    /**< number of new conflicts found this time */
+   SCIP_Bool             leavewassol,        /**< was a solution found at the leaf? */
+   SCIP_DIVECONTEXT      divecontext         /**< context for diving statistics */
+   );
+
 /** enforces a probing/diving solution by suggesting bound changes that maximize the score w.r.t. the current diving settings
  *
  *  the process is guided by the enforcement priorities of the constraint handlers and the scoring mechanism provided by
@@ -85,6 +85,10 @@
 #include "scip/tree.h"
 #include "xml/xml.h"
 
+#define BINSOL_MAGIC          "SCIPSOLB"     /**< identifier at the beginning of binary solution files */
+#define BINSOL_MAGICLEN       8              /**< length of identifier of binary solution files */
+#define BINSOL_VERSION        1              /**< version of the binary solution file format */
+
 
 /** update integrality violation of a solution */
 void SCIPupdateSolIntegralityViolation(
@@ -2411,6 +2415,46 @@ SCIP_RETCODE SCIPreadSol(
    return SCIP_OKAY;
 }
 
+/** sets the value of a variable read from a solution file; values of multiaggregated variables and conflicting values
+ *  of fixed variables are ignored
+ */
+static
+SCIP_RETCODE setSolValFromFile(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_SOL*             sol,                /**< solution pointer */
+   SCIP_VAR*             var,                /**< variable */
+   SCIP_Real             value               /**< value of variable */
+   )
+{
+   SCIP_RETCODE retcode;
+
+   /* set the solution value of the variable, if not multiaggregated */
+   if( SCIPisTransformed(scip) && SCIPvarGetStatus(SCIPvarGetProbvar(var)) == SCIP_VARSTATUS_MULTAGGR )
+   {
+      SCIPverbMessage(scip, SCIP_VERBLEVEL_NORMAL, NULL, "ignored solution value for multiaggregated variable <%s>\n", SCIPvarGetName(var));
+      return SCIP_OKAY;
+   }
+
+   retcode = SCIPsetSolVal(scip, sol, var, value);
+
+   if( retcode == SCIP_INVALIDDATA )
+   {
+      if( SCIPvarGetStatus(SCIPvarGetProbvar(var)) == SCIP_VARSTATUS_FIXED )
+      {
+         SCIPverbMessage(scip, SCIP_VERBLEVEL_NORMAL, NULL, "ignored conflicting solution value for fixed variable <%s>\n",
+            SCIPvarGetName(var));
+      }
+      else
+      {
+         SCIPverbMessage(scip, SCIP_VERBLEVEL_NORMAL, NULL, "ignored solution value for multiaggregated variable <%s>\n",
+            SCIPvarGetName(var));
+      }
+      return SCIP_OKAY;
+   }
+
+   return retcode;
+}
+
 /** reads a given solution file and store the solution values in the given solution pointer */
 static
 SCIP_RETCODE readSolFile(
@@ -2424,6 +2468,7 @@ SCIP_RETCODE readSolFile(
    SCIP_FILE* file;
    SCIP_Bool unknownvariablemessage;
    SCIP_Bool localpartial;
+   char format[SCIP_MAXSTRLEN];
    int lineno;
 
    assert(scip != NULL);
@@ -2445,6 +2490,9 @@ SCIP_RETCODE readSolFile(
    unknownvariablemessage = FALSE;
    lineno = 0;
 
+   /* the format of a line is the same for all lines */
+   (void) SCIPsnprintf(format, SCIP_MAXSTRLEN, "%%%ds %%%ds %%%ds\n", SCIP_MAXSTRLEN, SCIP_MAXSTRLEN, SCIP_MAXSTRLEN);
+
    /* read the file */
    while( !SCIPfeof(file) && !(*error) )
    {
@@ -2452,7 +2500,7 @@ SCIP_RETCODE readSolFile(
       char varname[SCIP_MAXSTRLEN];
       char valuestring[SCIP_MAXSTRLEN];
       char objstring[SCIP_MAXSTRLEN];
-      char format[SCIP_MAXSTRLEN];
+      char* endptr;
       SCIP_VAR* var;
       SCIP_Real value;
       int nread;
@@ -2471,7 +2519,6 @@ SCIP_RETCODE readSolFile(
          continue;
 
       /* parse the line */
-      (void) SCIPsnprintf(format, SCIP_MAXSTRLEN, "%%%ds %%%ds %%%ds\n", SCIP_MAXSTRLEN, SCIP_MAXSTRLEN, SCIP_MAXSTRLEN);
       nread = sscanf(buffer, format, varname, valuestring, objstring);
       if( nread < 2 )
       {
@@ -2508,9 +2555,7 @@ SCIP_RETCODE readSolFile(
       }
       else
       {
-         /* coverity[secure_coding] */
-         nread = sscanf(valuestring, "%lf", &value);
-         if( nread != 1 )
+         if( !SCIPstrToRealValue(valuestring, &value, &endptr) )
          {
             SCIPerrorMessage("Invalid solution value <%s> for variable <%s> in line %d of solution file <%s>.\n",
                valuestring, varname, lineno, filename);
@@ -2519,35 +2564,7 @@ SCIP_RETCODE readSolFile(
          }
       }
 
-      /* set the solution value of the variable, if not multiaggregated */
-      if( SCIPisTransformed(scip) && SCIPvarGetStatus(SCIPvarGetProbvar(var)) == SCIP_VARSTATUS_MULTAGGR )
-      {
-         SCIPverbMessage(scip, SCIP_VERBLEVEL_NORMAL, NULL, "ignored solution value for multiaggregated variable <%s>\n", SCIPvarGetName(var));
-      }
-      else
-      {
-         SCIP_RETCODE retcode;
-
-         retcode = SCIPsetSolVal(scip, sol, var, value);
-
-         if( retcode == SCIP_INVALIDDATA )
-         {
-            if( SCIPvarGetStatus(SCIPvarGetProbvar(var)) == SCIP_VARSTATUS_FIXED )
-            {
-               SCIPverbMessage(scip, SCIP_VERBLEVEL_NORMAL, NULL, "ignored conflicting solution value for fixed variable <%s>\n",
-                  SCIPvarGetName(var));
-            }
-            else
-            {
-               SCIPverbMessage(scip, SCIP_VERBLEVEL_NORMAL, NULL, "ignored solution value for multiaggregated variable <%s>\n",
-                  SCIPvarGetName(var));
-            }
-         }
-         else
-         {
-            SCIP_CALL_FINALLY( retcode, SCIPfclose(file) );
-         }
-      }
+      SCIP_CALL_FINALLY( setSolValFromFile(scip, sol, var, value), SCIPfclose(file) );
    }
 
    /* close input file */
@@ -2621,8 +2638,8 @@ SCIP_RETCODE readXmlSolFile(
       SCIP_VAR* var;
       const char* varname;
       const char* valuestring;
+      char* endptr;
       SCIP_Real value;
-      int nread;
 
       /* find variable name */
       varname = SCIPxmlGetAttrval(varnode, "name");
@@ -2670,9 +2687,7 @@ SCIP_RETCODE readXmlSolFile(
       }
       else
       {
-         /* coverity[secure_coding] */
-         nread = sscanf(valuestring, "%lf", &value);
-         if( nread != 1 )
+         if( !SCIPstrToRealValue(valuestring, &value, &endptr) )
          {
             SCIPwarningMessage(scip, "invalid solution value <%s> for variable <%s> in XML solution file <%s>\n", valuestring, varname, filename);
             *error = TRUE;
@@ -2680,34 +2695,7 @@ SCIP_RETCODE readXmlSolFile(
          }
       }
 
-      /* set the solution value of the variable, if not multiaggregated */
-      if( SCIPisTransformed(scip) && SCIPvarGetStatus(SCIPvarGetProbvar(var)) == SCIP_VARSTATUS_MULTAGGR )
-      {
-         SCIPverbMessage(scip, SCIP_VERBLEVEL_NORMAL, NULL, "ignored solution value for multiaggregated variable <%s>\n", SCIPvarGetName(var));
-      }
-      else
-      {
-         SCIP_RETCODE retcode;
-         retcode = SCIPsetSolVal(scip, sol, var, value);
-
-         if( retcode == SCIP_INVALIDDATA )
-         {
-            if( SCIPvarGetStatus(SCIPvarGetProbvar(var)) == SCIP_VARSTATUS_FIXED )
-            {
-               SCIPverbMessage(scip, SCIP_VERBLEVEL_NORMAL, NULL, "ignored conflicting solution value for fixed variable <%s>\n",
-                  SCIPvarGetName(var));
-            }
-            else
-            {
-               SCIPverbMessage(scip, SCIP_VERBLEVEL_NORMAL, NULL, "ignored solution value for multiaggregated variable <%s>\n",
-                  SCIPvarGetName(var));
-            }
-         }
-         else
-         {
-            SCIP_CALL( retcode );
-         }
-      }
+      SCIP_CALL_FINALLY( setSolValFromFile(scip, sol, var, value), SCIPxmlFreeNode(start) );
    }
 
    /* free xml data */
@@ -2767,6 +2755,238 @@ SCIP_RETCODE SCIPreadSolFile(
    return SCIP_OKAY;
 }
 
+/** computes a fingerprint of the original problem that identifies the variables of a binary solution file, which
+ *  are stored by their index in the original problem
+ */
+static
+uint64_t computeOrigProbFingerprint(
+   SCIP*                 scip                /**< SCIP data structure */
+   )
+{
+   SCIP_VAR** vars;
+   uint64_t fingerprint;
+   int nvars;
+   int v;
+
+   vars = SCIPgetOrigVars(scip);
+   nvars = SCIPgetNOrigVars(scip);
+
+   /* 64 bit FNV-1a hash over the number of variables and the names and types of all variables */
+   fingerprint = UINT64_C(14695981039346656037) ^ (uint64_t)nvars;
+   for( v = 0; v < nvars; ++v )
+   {
+      const char* name;
+
+      for( name = SCIPvarGetName(vars[v]); *name != '\0'; ++name )
+      {
+         fingerprint ^= (uint64_t)(unsigned char)*name;
+         fingerprint *= UINT64_C(1099511628211);
+      }
+      fingerprint ^= (uint64_t)SCIPvarGetType(vars[v]) + 256;
+      fingerprint *= UINT64_C(1099511628211);
+   }
+
+   return fingerprint;
+}
+
+/** writes the values of the original variables in a solution to a binary file
+ *
+ *  The file stores the values of all original variables as doubles in the order of SCIPgetOrigVars(), preceded by a
+ *  header with a fingerprint of the original problem. Names are not stored, so the file can only be read by
+ *  SCIPreadSolBinary() for the same original problem on a machine with the same byte order.
+ *
+ *  @return \ref SCIP_OKAY is returned if everything worked. Otherwise a suitable error code is passed. See \ref
+ *          SCIP_Retcode "SCIP_RETCODE" for a complete list of error codes.
+ *
+ *  @pre This method can be called if SCIP is in one of the following stages:
+ *       - \ref SCIP_STAGE_PROBLEM
+ *       - \ref SCIP_STAGE_TRANSFORMED
+ *       - \ref SCIP_STAGE_INITPRESOLVE
+ *       - \ref SCIP_STAGE_PRESOLVING
+ *       - \ref SCIP_STAGE_EXITPRESOLVE
+ *       - \ref SCIP_STAGE_PRESOLVED
+ *       - \ref SCIP_STAGE_INITSOLVE
+ *       - \ref SCIP_STAGE_SOLVING
+ *       - \ref SCIP_STAGE_SOLVED
+ *       - \ref SCIP_STAGE_EXITSOLVE
+ */
+SCIP_RETCODE SCIPwriteSolBinary(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_SOL*             sol,                /**< primal solution */
+   const char*           filename            /**< name of the output file */
+   )
+{
+   SCIP_Real* vals;
+   uint64_t fingerprint;
+   FILE* file;
+   int version;
+   int nvars;
+   SCIP_Bool success;
+
+   assert(sol != NULL);
+   assert(filename != NULL);
+
+   SCIP_CALL( SCIPcheckStage(scip, "SCIPwriteSolBinary", FALSE, TRUE, FALSE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, FALSE, FALSE) );
+
+   nvars = SCIPgetNOrigVars(scip);
+   SCIP_CALL( SCIPallocBufferArray(scip, &vals, nvars) );
+   SCIP_CALL( SCIPgetSolVals(scip, sol, nvars, SCIPgetOrigVars(scip), vals) );
+
+   file = fopen(filename, "wb");
+   if( file == NULL )
+   {
+      SCIPerrorMessage("cannot create file <%s> for writing\n", filename);
+      SCIPprintSysError(filename);
+      SCIPfreeBufferArray(scip, &vals);
+      return SCIP_FILECREATEERROR;
+   }
+
+   version = BINSOL_VERSION;
+   fingerprint = computeOrigProbFingerprint(scip);
+
+   success = fwrite(BINSOL_MAGIC, 1, BINSOL_MAGICLEN, file) == BINSOL_MAGICLEN
+      && fwrite(&version, sizeof(version), 1, file) == 1
+      && fwrite(&nvars, sizeof(nvars), 1, file) == 1
+      && fwrite(&fingerprint, sizeof(fingerprint), 1, file) == 1
+      && (nvars == 0 || fwrite(vals, sizeof(SCIP_Real), (size_t)nvars, file) == (size_t)nvars);
+
+   if( fclose(file) != 0 )
+      success = FALSE;
+
+   SCIPfreeBufferArray(scip, &vals);
+
+   if( !success )
+   {
+      SCIPerrorMessage("error writing binary solution file <%s>\n", filename);
+      return SCIP_WRITEERROR;
+   }
+
+   return SCIP_OKAY;
+}
+
+/** reads a binary solution file written by SCIPwriteSolBinary() and stores the solution values in the given solution
+ *  pointer; if the file was written for a different original problem, @p error is set to TRUE
+ *
+ *  @return \ref SCIP_OKAY is returned if everything worked. Otherwise a suitable error code is passed. See \ref
+ *          SCIP_Retcode "SCIP_RETCODE" for a complete list of error codes.
+ *
+ *  @pre This method can be called if SCIP is in one of the following stages:
+ *       - \ref SCIP_STAGE_PROBLEM
+ *       - \ref SCIP_STAGE_TRANSFORMED
+ *       - \ref SCIP_STAGE_INITPRESOLVE
+ *       - \ref SCIP_STAGE_PRESOLVING
+ *       - \ref SCIP_STAGE_EXITPRESOLVE
+ *       - \ref SCIP_STAGE_PRESOLVED
+ *       - \ref SCIP_STAGE_INITSOLVE
+ *       - \ref SCIP_STAGE_SOLVING
+ */
+SCIP_RETCODE SCIPreadSolBinary(
+   SCIP*                 scip,               /**< SCIP data structure */
+   const char*           filename,           /**< name of the input file */
+   SCIP_SOL*             sol,                /**< solution pointer */
+   SCIP_Bool*            partial,            /**< pointer to store if the solution is partial (or NULL, if not needed) */
+   SCIP_Bool*            error               /**< pointer store if an error occured */
+   )
+{
+   char magic[BINSOL_MAGICLEN];
+   SCIP_VAR** vars;
+   SCIP_Real* vals;
+   uint64_t fingerprint;
+   FILE* file;
+   SCIP_Bool localpartial;
+   int version;
+   int nvars;
+   int v;
+
+   assert(filename != NULL);
+   assert(sol != NULL);
+   assert(error != NULL);
+
+   SCIP_CALL( SCIPcheckStage(scip, "SCIPreadSolBinary", FALSE, TRUE, FALSE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, TRUE, FALSE, FALSE, FALSE, FALSE) );
+
+   file = fopen(filename, "rb");
+   if( file == NULL )
+   {
+      SCIPerrorMessage("cannot open file <%s> for reading\n", filename);
+      SCIPprintSysError(filename);
+      return SCIP_NOFILE;
+   }
+
+   *error = FALSE;
+   vars = SCIPgetOrigVars(scip);
+
+   if( fread(magic, 1, BINSOL_MAGICLEN, file) != BINSOL_MAGICLEN || memcmp(magic, BINSOL_MAGIC, BINSOL_MAGICLEN) != 0
+      || fread(&version, sizeof(version), 1, file) != 1 || version != BINSOL_VERSION )
+   {
+      SCIPerrorMessage("file <%s> is not a binary solution file of this version\n", filename);
+      *error = TRUE;
+   }
+   else if( fread(&nvars, sizeof(nvars), 1, file) != 1 || fread(&fingerprint, sizeof(fingerprint), 1, file) != 1
+      || nvars != SCIPgetNOrigVars(scip) || fingerprint != computeOrigProbFingerprint(scip) )
+   {
+      SCIPerrorMessage("binary solution file <%s> does not belong to the current problem\n", filename);
+      *error = TRUE;
+   }
+
+   if( *error )
+   {
+      (void) fclose(file);
+      return SCIP_OKAY;
+   }
+
+   SCIP_CALL_FINALLY( SCIPallocBufferArray(scip, &vals, nvars), (void) fclose(file) );
+
+   if( nvars > 0 && fread(vals, sizeof(SCIP_Real), (size_t)nvars, file) != (size_t)nvars )
+   {
+      SCIPerrorMessage("unexpected end of binary solution file <%s>\n", filename);
+      *error = TRUE;
+   }
+   (void) fclose(file);
+
+   localpartial = SCIPsolIsPartial(sol);
+
+   if( !(*error) )
+   {
+      for( v = 0; v < nvars; ++v )
+      {
+         if( vals[v] == SCIP_UNKNOWN ) /*lint !e777*/
+            localpartial = TRUE;
+      }
+
+      /* in an original solution, all values are set at once; otherwise the values of multiaggregated variables and
+       * conflicting values of fixed variables are skipped as for the other solution file formats
+       */
+      if( SCIPsolIsOriginal(sol) )
+      {
+         SCIP_CALL_FINALLY( SCIPsetSolVals(scip, sol, nvars, vars, vals), SCIPfreeBufferArray(scip, &vals) );
+      }
+      else
+      {
+         for( v = 0; v < nvars; ++v )
+         {
+            SCIP_CALL_FINALLY( setSolValFromFile(scip, sol, vars[v], vals[v]), SCIPfreeBufferArray(scip, &vals) );
+         }
+      }
+   }
+
+   SCIPfreeBufferArray(scip, &vals);
+
+   if( localpartial && !SCIPsolIsPartial(sol) )
+   {
+      if( SCIPgetStage(scip) == SCIP_STAGE_PROBLEM )
+      {
+         SCIP_CALL( SCIPsolMarkPartial(sol, scip->set, scip->stat, scip->origprob->vars, scip->origprob->nvars) );
+      }
+      else
+         *error = TRUE;
+   }
+
+   if( partial != NULL )
+      *partial = localpartial;
+
+   return SCIP_OKAY;
+}
+
 /** adds feasible primal solution to solution storage by copying it
  *
  *  @return \ref SCIP_OKAY is returned if everything worked. Otherwise a suitable error code is passed. See \ref
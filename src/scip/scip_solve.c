@@ -81,6 +81,7 @@
 #include "scip/scip_branch.h"
 #include "scip/scip_concurrent.h"
 #include "scip/scip_cons.h"
+#include "scip/scip_dcmp.h"
 #include "scip/scip_general.h"
 #include "scip/scip_lp.h"
 #include "scip/scip_mem.h"
@@ -2541,6 +2542,13 @@ SCIP_RETCODE SCIPsolve(
    /* initialize presolving flag (may be modified in SCIPpresolve()) */
    scip->stat->performpresol = FALSE;
 
+   /* if no decomposition is given, try to detect one automatically */
+   if( scip->set->stage == SCIP_STAGE_PROBLEM && SCIPdecompstoreGetNOrigDecomps(scip->decompstore) == 0
+      && scip->set->decomp_detect )
+   {
+      SCIP_CALL( SCIPdetectDecomp(scip, TRUE, NULL) );
+   }
+
    /* if a decomposition exists and Benders' decomposition has been enabled, then a decomposition is performed */
    if( scip->set->stage == SCIP_STAGE_PROBLEM && SCIPdecompstoreGetNOrigDecomps(scip->decompstore) > 0
       && scip->set->decomp_applybenders && SCIPgetNActiveBenders(scip) == 0 )
@@ -102,6 +102,7 @@ SCIP_RETCODE SCIPincludeDefaultPlugins(
    SCIP_CALL( SCIPincludeReaderCcg(scip) );
 
    SCIP_CALL( SCIPincludePresolBoundshift(scip) );
+   SCIP_CALL( SCIPincludePresolCache(scip) );
    SCIP_CALL( SCIPincludePresolConvertinttobin(scip) );
    SCIP_CALL( SCIPincludePresolDomcol(scip) );
    SCIP_CALL( SCIPincludePresolDualagg(scip) );
@@ -175,6 +175,7 @@
 #include "scip/nodesel_uct.h"
 #include "scip/nodesel_restartdfs.h"
 #include "scip/presol_boundshift.h"
+#include "scip/presol_cache.h"
 #include "scip/presol_convertinttobin.h"
 #include "scip/presol_domcol.h"
 #include "scip/presol_dualagg.h"
@@ -168,6 +168,9 @@ struct AggregationData {
    SCIP_Real*            bounddist;          /**< bound distance of continuous variables */
    int*                  bounddistinds;      /**< problem indices of the continUous variables corresponding to the bounddistance value */
    int                   nbounddistvars;     /**< number of continuous variables that are not at their bounds */
+   int*                  bounddistpos;       /**< position of each non-integral variable in the bounddist array, or -1 if
+                                              *   it is at its bound; indexed by problem index minus firstbounddistvar */
+   int                   firstbounddistvar;  /**< problem index of the first non-integral variable */
    SCIP_ROW**            aggrrows;           /**< array of rows suitable for substitution of continuous variable */
    SCIP_Real*            aggrrowscoef;       /**< coefficient of continuous variable in row that is suitable for substitution of that variable */
    int                   aggrrowssize;       /**< size of aggrrows array */
@@ -334,12 +337,14 @@ SCIP_RETCODE setupAggregationData(
    SCIP_CALL( SCIPallocBufferArray(scip, &aggrdata->bounddistinds, ncontvars + nimplvars) );
    SCIP_CALL( SCIPallocBufferArray(scip, &aggrdata->ngoodaggrrows, ncontvars + nimplvars) );
    SCIP_CALL( SCIPallocBufferArray(scip, &aggrdata->aggrrowsstart, ncontvars + nimplvars + 1) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &aggrdata->bounddistpos, ncontvars + nimplvars) );
    SCIP_CALL( SCIPallocBufferArray(scip, &aggrdata->nbadvarsinrow, nrows) );
    SCIP_CALL( SCIPaggrRowCreate(scip, &aggrdata->aggrrow) );
    assert( aggrdata->aggrrow != NULL );
    BMSclearMemoryArray(aggrdata->nbadvarsinrow, nrows);
 
    aggrdata->nbounddistvars = 0;
+   aggrdata->firstbounddistvar = nbinvars + nintvars;
    aggrdata->aggrrows = NULL;
    aggrdata->aggrrowscoef = NULL;
    aggrdata->aggrrowssize = 0;
@@ -390,11 +395,14 @@ SCIP_RETCODE setupAggregationData(
       if( i < firstcontvar )
          bounddist *= 0.1;
 
+      aggrdata->bounddistpos[i - aggrdata->firstbounddistvar] = -1;
+
       /* when variable is not at its bound, we want to project it out, so add it to the aggregation data */
       if( !SCIPisZero(scip, bounddist) )
       {
          int k = aggrdata->nbounddistvars++;
 
+         aggrdata->bounddistpos[i - aggrdata->firstbounddistvar] = k;
          aggrdata->bounddist[k] = bounddist;
          aggrdata->bounddistinds[k] = i;
          aggrdata->aggrrowsstart[k] = aggrdata->naggrrows;
@@ -503,12 +511,27 @@ void destroyAggregationData(
    SCIPfreeBufferArrayNull(scip, &aggrdata->aggrrowscoef);
    SCIPfreeBufferArrayNull(scip, &aggrdata->aggrrows);
    SCIPfreeBufferArray(scip, &aggrdata->nbadvarsinrow);
+   SCIPfreeBufferArray(scip, &aggrdata->bounddistpos);
    SCIPfreeBufferArray(scip, &aggrdata->aggrrowsstart);
    SCIPfreeBufferArray(scip, &aggrdata->ngoodaggrrows);
    SCIPfreeBufferArray(scip, &aggrdata->bounddistinds);
    SCIPfreeBufferArray(scip, &aggrdata->bounddist);
 }
 
+/** returns the position of the given non-integral variable in the bound distance arrays of the aggregation data, or -1
+ *  if the variable is at its bound
+ */
+static
+int aggrdataGetBoundDistPos(
+   AGGREGATIONDATA*      aggrdata,           /**< pointer to aggregation data */
+   int                   probvaridx          /**< problem index of a non-integral variable */
+   )
+{
+   assert(probvaridx >= aggrdata->firstbounddistvar);
+
+   return aggrdata->bounddistpos[probvaridx - aggrdata->firstbounddistvar];
+}
+
 /** retrieves the candidate rows for canceling out the given variable, also returns the number of "good" rows which are the
  *  rows stored at the first ngoodrows positions. A row is good if its continuous variables are all at their bounds, except
  *  maybe the given continuous variable (in probvaridx)
@@ -525,9 +548,13 @@ SCIP_Bool getRowAggregationCandidates(
 {
    int aggrdataidx;
 
-   if( !SCIPsortedvecFindInt(aggrdata->bounddistinds, probvaridx, aggrdata->nbounddistvars, &aggrdataidx) )
+   aggrdataidx = aggrdataGetBoundDistPos(aggrdata, probvaridx);
+
+   if( aggrdataidx < 0 )
       return FALSE;
 
+   assert(aggrdata->bounddistinds[aggrdataidx] == probvaridx);
+
    *rows = aggrdata->aggrrows + aggrdata->aggrrowsstart[aggrdataidx];
    *nrows = aggrdata->aggrrowsstart[aggrdataidx + 1] - aggrdata->aggrrowsstart[aggrdataidx];
    *rowvarcoefs = aggrdata->aggrrowscoef + aggrdata->aggrrowsstart[aggrdataidx];
@@ -545,9 +572,13 @@ SCIP_Real aggrdataGetBoundDist(
 {
    int aggrdataidx;
 
-   if( !SCIPsortedvecFindInt(aggrdata->bounddistinds, probvaridx, aggrdata->nbounddistvars, &aggrdataidx) )
+   aggrdataidx = aggrdataGetBoundDistPos(aggrdata, probvaridx);
+
+   if( aggrdataidx < 0 )
       return 0.0;
 
+   assert(aggrdata->bounddistinds[aggrdataidx] == probvaridx);
+
    return aggrdata->bounddist[aggrdataidx];
 }
 
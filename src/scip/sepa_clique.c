@@ -337,6 +337,7 @@ static
 SCIP_RETCODE tcliquegraphConstructCliqueTable(
    SCIP*                 scip,               /**< SCIP data structure */
    TCLIQUE_GRAPH*        tcliquegraph,       /**< tclique graph data */
+   int**                 cliquegraphidx,     /**< tclique graph node index of variable/value pairs */
    SCIP_Real             cliquetablemem,     /**< maximal memory size of dense clique table (in kb) */
    SCIP_Real             cliquedensity       /**< minimal density of cliques to store as dense table */
    )
@@ -358,6 +359,7 @@ SCIP_RETCODE tcliquegraphConstructCliqueTable(
       return SCIP_OKAY;
 
    assert(tcliquegraph != NULL);
+   assert(cliquegraphidx != NULL);
 
    /* calculate size of dense clique table */
    nbits = 8*sizeof(unsigned int);
@@ -402,17 +404,14 @@ SCIP_RETCODE tcliquegraphConstructCliqueTable(
       /* get the node numbers of the variables */
       for( u = 0; u < nvars && !SCIPisStopped(scip); ++u )
       {
-         SCIP_VAR* var;
-
          /* implicit integer and integer variables are currently not present in the constructed tclique graph */
          if( SCIPvarGetType(vars[u]) != SCIP_VARTYPE_BINARY )
             continue;
 
-         var = (vals[u] ? vars[u] : SCIPvarGetNegatedVar(vars[u]));
-         assert(var != NULL); /* var must exist even if negated, since it is stored in the tcliquegraph */
-         for( v = 0; v < tcliquegraph->nnodes && var != tcliquegraph->vars[v]; ++v )
-         {}
-         assert(v < tcliquegraph->nnodes);
+         assert(SCIPvarGetProbindex(vars[u]) >= 0 && SCIPvarGetProbindex(vars[u]) < SCIPgetNBinVars(scip));
+         v = cliquegraphidx[vals[u] ? 1 : 0][SCIPvarGetProbindex(vars[u])];
+         assert(0 <= v && v < tcliquegraph->nnodes);
+         assert(tcliquegraph->vars[v] == (vals[u] ? vars[u] : SCIPvarGetNegatedVar(vars[u])));
          varids[u] = v;
       }
 
@@ -494,7 +493,8 @@ SCIP_RETCODE loadTcliquegraph(
    if( sepadata->tcliquegraph != NULL )
    {
       /* construct the dense clique table */
-      SCIP_CALL( tcliquegraphConstructCliqueTable(scip, sepadata->tcliquegraph, sepadata->cliquetablemem, sepadata->cliquedensity) );
+      SCIP_CALL( tcliquegraphConstructCliqueTable(scip, sepadata->tcliquegraph, cliquegraphidx,
+            sepadata->cliquetablemem, sepadata->cliquedensity) );
    }
 
    /* free temporary memory */
@@ -672,6 +672,34 @@ TCLIQUE_SELECTADJNODES(tcliqueSelectadjnodesClique)
    graphadjnodes = tcliquegraph->adjnodes;
    nodeadjindex = tcliquegraph->adjnodesidxs[node];
    nodeadjend = tcliquegraph->adjnodesidxs[node+1];
+
+   /* if the node has no explicit adjacent nodes and the dense clique table is available, the neighborhood is given by
+    * the node's row in the table, which can be tested directly
+    */
+   if( nodeadjindex == nodeadjend && tcliquegraph->cliquetable != NULL )
+   {
+      unsigned int* tablerow;
+      int nbits;
+
+      nbits = 8*sizeof(unsigned int);
+      tablerow = &tcliquegraph->cliquetable[node*tcliquegraph->tablewidth];
+      for( i = 0; i < nnodes; i++ )
+      {
+         assert(0 <= nodes[i] && nodes[i] < tcliquegraph->nnodes);
+         assert(i == 0 || nodes[i-1] < nodes[i]);
+         assert(((tablerow[nodes[i]/nbits] & (1U << (nodes[i] % nbits))) != 0) /*lint !e701*/
+            == nodesHaveCommonClique(tcliquegraph, node, nodes[i]) || nodes[i] == node);
+
+         if( nodes[i] == node || (tablerow[nodes[i]/nbits] & (1U << (nodes[i] % nbits))) != 0 ) /*lint !e701*/
+         {
+            adjnodes[nadjnodes] = nodes[i];
+            nadjnodes++;
+         }
+      }
+
+      return nadjnodes;
+   }
+
    for( i = 0; i < nnodes; i++ )
    {
       /* check if the node is adjacent to the given node (nodes and adjacent nodes are ordered by node index) */
@@ -179,6 +179,8 @@ struct SCIP_SepaData
    SCIP_RANDNUMGEN*      randnumgen;         /**< random generator for tiebreaking */
    SCIP_AGGRROW*         aggrrow;            /**< aggregation row used for generating cuts */
    SCIP_ROW**            cuts;               /**< generated in the current call */
+   void**                colinfos;           /**< mod 2 column and right hand side offset (see COLINFO_CREATE) of each
+                                              *   integral problem variable, indexed by problem index; kept between calls */
    SCIP_Real             minviol;            /**< minimal violation to generate zerohalfcut for */
    SCIP_Real             maxslack;           /**< maximal slack of rows to be used in aggregation */
    SCIP_Real             maxslackroot;       /**< maximal slack of rows to be used in aggregation in the root node */
@@ -201,6 +203,7 @@ struct SCIP_SepaData
    int                   densityoffset;      /**< additional number of variables allowed in row on top of density */
    int                   initseed;           /**< initial seed used for random tie-breaking in cut selection */
    int                   cutssize;           /**< size of cuts and cutscores arrays */
+   int                   colinfossize;       /**< size of colinfos array */
    int                   ncuts;              /**< number of cuts generated in the current call */
    int                   nreductions;        /**< number of reductions to the mod 2 system found so far */
 };
@@ -721,7 +724,7 @@ static
 SCIP_RETCODE mod2MatrixAddCol(
    SCIP*                 scip,               /**< SCIP datastructure */
    MOD2_MATRIX*          mod2matrix,         /**< mod 2 matrix */
-   SCIP_HASHMAP*         origvar2col,        /**< hash map for mapping of problem variables to mod 2 columns */
+   void**                colinfos,           /**< array to store the mod 2 column of each integral problem variable */
    SCIP_VAR*             origvar,            /**< problem variable to create mod 2 column for */
    SCIP_Real             solval,             /**< solution value of problem variable */
    int                   rhsoffset           /**< offset in right hand side due complementation (mod 2) */
@@ -744,7 +747,7 @@ SCIP_RETCODE mod2MatrixAddCol(
 
    /* create mapping of problem variable to mod 2 column with its right hand side offset */
    assert(rhsoffset >= 0);
-   SCIP_CALL( SCIPhashmapInsert(origvar2col, (void*) origvar, COLINFO_CREATE(col, rhsoffset)) ); /*lint !e571*/
+   colinfos[col->index] = COLINFO_CREATE(col, rhsoffset); /*lint !e571*/
 
    return SCIP_OKAY;
 }
@@ -825,7 +828,7 @@ SCIP_RETCODE mod2MatrixAddOrigRow(
    SCIP*                 scip,               /**< scip data structure */
    BMS_BLKMEM*           blkmem,             /**< block memory shell */
    MOD2_MATRIX*          mod2matrix,         /**< modulo 2 matrix */
-   SCIP_HASHMAP*         origcol2col,        /**< hashmap to retrieve the mod 2 column from a SCIP_COL */
+   void**                colinfos,           /**< array to retrieve the mod 2 column of an integral problem variable */
    SCIP_ROW*             origrow,            /**< original SCIP row */
    SCIP_Real             slack,              /**< slack of row */
    ROWIND_TYPE           side,               /**< side of row that is used for mod 2 row, must be ORIG_RHS or ORIG_LHS */
@@ -874,7 +877,8 @@ SCIP_RETCODE mod2MatrixAddOrigRow(
          MOD2_COL* col;
          int rhsoffset;
 
-         colinfo = SCIPhashmapGetImage(origcol2col, (void*)SCIPcolGetVar(rowcols[i]));
+         assert(SCIPcolIsIntegral(rowcols[i]));
+         colinfo = colinfos[SCIPcolGetVarProbindex(rowcols[i])];
 
          /* extract the righthand side offset from the colinfo and update the righthand side */
          rhsoffset = COLINFO_GET_RHSOFFSET(colinfo);
@@ -909,19 +913,17 @@ static
 SCIP_RETCODE mod2MatrixAddTransRow(
    SCIP*                 scip,               /**< scip data structure */
    MOD2_MATRIX*          mod2matrix,         /**< modulo 2 matrix */
-   SCIP_HASHMAP*         origcol2col,        /**< hashmap to retrieve the mod 2 column from a SCIP_COL */
+   void**                colinfos,           /**< array to retrieve the mod 2 column of an integral problem variable */
    int                   transrowind         /**< index to transformed int row */
    )
 {
    int i;
-   SCIP_VAR** vars;
    BMS_BLKMEM* blkmem;
    MOD2_ROW* row;
    TRANSINTROW* introw;
 
    SCIP_CALL( SCIPallocBlockMemory(scip, &row) );
 
-   vars = SCIPgetVars(scip);
    introw = &mod2matrix->transintrows[transrowind];
 
    blkmem = SCIPblkmem(scip);
@@ -955,7 +957,7 @@ SCIP_RETCODE mod2MatrixAddTransRow(
          MOD2_COL* col;
          int rhsoffset;
 
-         colinfo = SCIPhashmapGetImage(origcol2col, (void*)vars[introw->varinds[i]]);
+         colinfo = colinfos[introw->varinds[i]];
 
          /* extract the righthand side offset from the colinfo and update the righthand side */
          rhsoffset = COLINFO_GET_RHSOFFSET(colinfo);
@@ -1036,7 +1038,7 @@ SCIP_RETCODE buildMod2Matrix(
    SCIP_VAR** vars;
    SCIP_ROW** rows;
    SCIP_COL** cols;
-   SCIP_HASHMAP* origcol2col;
+   void** colinfos;
    int ncols;
    int nrows;
    int nintvars;
@@ -1057,7 +1059,11 @@ SCIP_RETCODE buildMod2Matrix(
    mod2matrix->nrows = 0;
    mod2matrix->nzeroslackrows = 0;
 
-   SCIP_CALL( SCIPhashmapCreate(&origcol2col, SCIPblkmem(scip), 1) );
+   /* the mapping of integral variables to mod 2 columns is stored in an array that is reused between calls; all
+    * entries up to nintvars are overwritten below
+    */
+   SCIP_CALL( SCIPensureBlockMemoryArray(scip, &sepadata->colinfos, &sepadata->colinfossize, nintvars) );
+   colinfos = sepadata->colinfos;
 
    /* add all integral vars if they are not at their bound */
    for( i = 0; i < nintvars; ++i )
@@ -1075,7 +1081,7 @@ SCIP_RETCODE buildMod2Matrix(
       lbsol = MAX(0.0, primsol - lb);
       if( SCIPisZero(scip, lbsol) )
       {
-         SCIP_CALL( SCIPhashmapInsert(origcol2col, (void*) vars[i], COLINFO_CREATE(NULL, mod2(scip, lb))) ); /*lint !e571*/
+         colinfos[i] = COLINFO_CREATE(NULL, mod2(scip, lb)); /*lint !e571*/
          continue;
       }
 
@@ -1083,7 +1089,7 @@ SCIP_RETCODE buildMod2Matrix(
       ubsol = MAX(0.0, ub - primsol);
       if( SCIPisZero(scip, ubsol) )
       {
-         SCIP_CALL( SCIPhashmapInsert(origcol2col, (void*) vars[i], COLINFO_CREATE(NULL, mod2(scip, ub))) ); /*lint !e571*/
+         colinfos[i] = COLINFO_CREATE(NULL, mod2(scip, ub)); /*lint !e571*/
          continue;
       }
 
@@ -1101,14 +1107,14 @@ SCIP_RETCODE buildMod2Matrix(
          assert(ubsol > 0.0);
 
          /* coverity[var_deref_model] */
-         SCIP_CALL( mod2MatrixAddCol(scip, mod2matrix, origcol2col, vars[i], ubsol, mod2(scip, ub)) );
+         SCIP_CALL( mod2MatrixAddCol(scip, mod2matrix, colinfos, vars[i], ubsol, mod2(scip, ub)) );
       }
       else
       {
          assert(lbsol > 0.0);
 
          /* coverity[var_deref_model] */
-         SCIP_CALL( mod2MatrixAddCol(scip, mod2matrix, origcol2col, vars[i], lbsol, mod2(scip, lb)) );
+         SCIP_CALL( mod2MatrixAddCol(scip, mod2matrix, colinfos, vars[i], lbsol, mod2(scip, lb)) );
       }
    }
 
@@ -1166,27 +1172,27 @@ SCIP_RETCODE buildMod2Matrix(
 
             /* use rhs */
             /* coverity[var_deref_model] */
-            SCIP_CALL( mod2MatrixAddOrigRow(scip, blkmem, mod2matrix, origcol2col, rows[i], rhsslack, ORIG_RHS, rhsmod2) );
+            SCIP_CALL( mod2MatrixAddOrigRow(scip, blkmem, mod2matrix, colinfos, rows[i], rhsslack, ORIG_RHS, rhsmod2) );
          }
          else
          {
             /* use both */
             /* coverity[var_deref_model] */
-            SCIP_CALL( mod2MatrixAddOrigRow(scip, blkmem, mod2matrix, origcol2col, rows[i], lhsslack, ORIG_LHS, lhsmod2) );
-            SCIP_CALL( mod2MatrixAddOrigRow(scip, blkmem, mod2matrix, origcol2col, rows[i], rhsslack, ORIG_RHS, rhsmod2) );
+            SCIP_CALL( mod2MatrixAddOrigRow(scip, blkmem, mod2matrix, colinfos, rows[i], lhsslack, ORIG_LHS, lhsmod2) );
+            SCIP_CALL( mod2MatrixAddOrigRow(scip, blkmem, mod2matrix, colinfos, rows[i], rhsslack, ORIG_RHS, rhsmod2) );
          }
       }
       else if( rhsslack <= maxslack )
       {
          /* use rhs */
          /* coverity[var_deref_model] */
-         SCIP_CALL( mod2MatrixAddOrigRow(scip, blkmem, mod2matrix, origcol2col, rows[i], rhsslack, ORIG_RHS, rhsmod2) );
+         SCIP_CALL( mod2MatrixAddOrigRow(scip, blkmem, mod2matrix, colinfos, rows[i], rhsslack, ORIG_RHS, rhsmod2) );
       }
       else if( lhsslack <= maxslack )
       {
          /* use lhs */
          /* coverity[var_deref_model] */
-         SCIP_CALL( mod2MatrixAddOrigRow(scip, blkmem, mod2matrix, origcol2col, rows[i], lhsslack, ORIG_LHS, lhsmod2) );
+         SCIP_CALL( mod2MatrixAddOrigRow(scip, blkmem, mod2matrix, colinfos, rows[i], lhsslack, ORIG_LHS, lhsmod2) );
       }
    }
 
@@ -1196,11 +1202,9 @@ SCIP_RETCODE buildMod2Matrix(
    /* add all transformed integral rows using the created columns */
    for( i = 0; i < mod2matrix->ntransintrows; ++i )
    {
-      SCIP_CALL( mod2MatrixAddTransRow(scip, mod2matrix, origcol2col, i) );
+      SCIP_CALL( mod2MatrixAddTransRow(scip, mod2matrix, colinfos, i) );
    }
 
-   SCIPhashmapFree(&origcol2col);
-
    return SCIP_OKAY;
 }
 
@@ -2160,6 +2164,8 @@ SCIP_DECL_SEPAEXITSOL(sepaExitsolZerohalf)
    assert(sepadata != NULL);
 
    SCIPfreeRandom(scip, &sepadata->randnumgen);
+   SCIPfreeBlockMemoryArrayNull(scip, &sepadata->colinfos, sepadata->colinfossize);
+   sepadata->colinfossize = 0;
 
    return SCIP_OKAY;
 }
@@ -366,6 +366,9 @@
 #define SCIP_DEFAULT_DECOMP_APPLYBENDERS  FALSE /**< if a decomposition exists, should Benders' decomposition be applied? */
 #define SCIP_DEFAULT_DECOMP_MAXGRAPHEDGE  10000 /**< maximum number of edges in block graph computation (-1: no limit, 0: disable block graph computation) */
 #define SCIP_DEFAULT_DECOMP_DISABLEMEASURES FALSE /**< disable expensive measures */
+#define SCIP_DEFAULT_DECOMP_DETECT        FALSE /**< should a decomposition be detected automatically if none is given? */
+#define SCIP_DEFAULT_DECOMP_DETECTMAXBLOCKS   8 /**< maximum number of blocks of an automatically detected decomposition */
+#define SCIP_DEFAULT_DECOMP_DETECTIMBALANCE 0.1 /**< allowed relative deviation of the block sizes from the average */
 
 /* Benders' decomposition */
 #define SCIP_DEFAULT_BENDERS_SOLTOL        1e-6 /**< the tolerance used to determine optimality in Benders' decomposition */
@@ -2280,6 +2283,21 @@ SCIP_RETCODE SCIPsetCreate(
       "disable expensive measures",
       &(*set)->decomp_disablemeasures, FALSE, SCIP_DEFAULT_DECOMP_DISABLEMEASURES,
       NULL, NULL) );
+   SCIP_CALL( SCIPsetAddBoolParam(*set, messagehdlr, blkmem,
+         "decomposition/detect",
+         "should a decomposition of the original problem be detected automatically if none is given?",
+         &(*set)->decomp_detect, FALSE, SCIP_DEFAULT_DECOMP_DETECT,
+         NULL, NULL) );
+   SCIP_CALL( SCIPsetAddIntParam(*set, messagehdlr, blkmem,
+         "decomposition/detectmaxblocks",
+         "maximum number of blocks of an automatically detected decomposition",
+         &(*set)->decomp_detectmaxblocks, TRUE, SCIP_DEFAULT_DECOMP_DETECTMAXBLOCKS, 2, 1024,
+         NULL, NULL) );
+   SCIP_CALL( SCIPsetAddRealParam(*set, messagehdlr, blkmem,
+         "decomposition/detectimbalance",
+         "allowed relative deviation of the block sizes from the average in automatic decomposition detection",
+         &(*set)->decomp_detectimbalance, TRUE, SCIP_DEFAULT_DECOMP_DETECTIMBALANCE, 0.0, 10.0,
+         NULL, NULL) );
 
    /* Benders' decomposition parameters */
    SCIP_CALL( SCIPsetAddRealParam(*set, messagehdlr, blkmem,
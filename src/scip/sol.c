@@ -2282,6 +2282,34 @@ SCIP_Bool SCIPsolsAreEqual(
    return TRUE;
 }
 
+/** prints the line of a variable's solution value in the format of SCIPsolPrint() using a single message call */
+static
+void solPrintVal(
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_MESSAGEHDLR*     messagehdlr,        /**< message handler */
+   FILE*                 file,               /**< output file (or NULL for standard output) */
+   SCIP_VAR*             var,                /**< variable */
+   SCIP_Real             solval,             /**< solution value of variable */
+   SCIP_Bool             signspace           /**< should a blank be printed in place of the sign of positive values? */
+   )
+{
+   if( solval == SCIP_UNKNOWN ) /*lint !e777*/
+      SCIPmessageFPrintInfo(messagehdlr, file, "%-32s              unknown \t(obj:%.15g)\n", SCIPvarGetName(var),
+         SCIPvarGetUnchangedObj(var));
+   else if( SCIPsetIsInfinity(set, solval) )
+      SCIPmessageFPrintInfo(messagehdlr, file, "%-32s            +infinity \t(obj:%.15g)\n", SCIPvarGetName(var),
+         SCIPvarGetUnchangedObj(var));
+   else if( SCIPsetIsInfinity(set, -solval) )
+      SCIPmessageFPrintInfo(messagehdlr, file, "%-32s            -infinity \t(obj:%.15g)\n", SCIPvarGetName(var),
+         SCIPvarGetUnchangedObj(var));
+   else if( signspace )
+      SCIPmessageFPrintInfo(messagehdlr, file, "%-32s % 20.15g \t(obj:%.15g)\n", SCIPvarGetName(var), solval,
+         SCIPvarGetUnchangedObj(var));
+   else
+      SCIPmessageFPrintInfo(messagehdlr, file, "%-32s %20.15g \t(obj:%.15g)\n", SCIPvarGetName(var), solval,
+         SCIPvarGetUnchangedObj(var));
+}
+
 /** outputs non-zero elements of solution to file stream */
 SCIP_RETCODE SCIPsolPrint(
    SCIP_SOL*             sol,                /**< primal CIP solution */
@@ -2317,16 +2345,7 @@ SCIP_RETCODE SCIPsolPrint(
          || (sol->solorigin != SCIP_SOLORIGIN_PARTIAL && !SCIPsetIsZero(set, solval))
          || (sol->solorigin == SCIP_SOLORIGIN_PARTIAL && solval != SCIP_UNKNOWN) ) /*lint !e777*/
       {
-         SCIPmessageFPrintInfo(messagehdlr, file, "%-32s", SCIPvarGetName(prob->fixedvars[v]));
-         if( solval == SCIP_UNKNOWN ) /*lint !e777*/
-            SCIPmessageFPrintInfo(messagehdlr, file, "              unknown");
-         else if( SCIPsetIsInfinity(set, solval) )
-            SCIPmessageFPrintInfo(messagehdlr, file, "            +infinity");
-         else if( SCIPsetIsInfinity(set, -solval) )
-            SCIPmessageFPrintInfo(messagehdlr, file, "            -infinity");
-         else
-            SCIPmessageFPrintInfo(messagehdlr, file, " % 20.15g", solval);
-         SCIPmessageFPrintInfo(messagehdlr, file, " \t(obj:%.15g)\n", SCIPvarGetUnchangedObj(prob->fixedvars[v]));
+         solPrintVal(set, messagehdlr, file, prob->fixedvars[v], solval, TRUE);
       }
    }
 
@@ -2343,16 +2362,7 @@ SCIP_RETCODE SCIPsolPrint(
          || (sol->solorigin != SCIP_SOLORIGIN_PARTIAL && !SCIPsetIsZero(set, solval))
          || (sol->solorigin == SCIP_SOLORIGIN_PARTIAL && solval != SCIP_UNKNOWN) ) /*lint !e777*/
       {
-         SCIPmessageFPrintInfo(messagehdlr, file, "%-32s", SCIPvarGetName(prob->vars[v]));
-         if( solval == SCIP_UNKNOWN ) /*lint !e777*/
-            SCIPmessageFPrintInfo(messagehdlr, file, "              unknown");
-         else if( SCIPsetIsInfinity(set, solval) )
-            SCIPmessageFPrintInfo(messagehdlr, file, "            +infinity");
-         else if( SCIPsetIsInfinity(set, -solval) )
-            SCIPmessageFPrintInfo(messagehdlr, file, "            -infinity");
-         else
-            SCIPmessageFPrintInfo(messagehdlr, file, " %20.15g", solval);
-         SCIPmessageFPrintInfo(messagehdlr, file, " \t(obj:%.15g)\n", SCIPvarGetUnchangedObj(prob->vars[v]));
+         solPrintVal(set, messagehdlr, file, prob->vars[v], solval, FALSE);
       }
    }
 
@@ -2376,16 +2386,7 @@ SCIP_RETCODE SCIPsolPrint(
          solval = SCIPsolGetVal(sol, set, stat, transprob->fixedvars[v]);
          if( printzeros || mipstart || !SCIPsetIsZero(set, solval) )
          {
-            SCIPmessageFPrintInfo(messagehdlr, file, "%-32s", SCIPvarGetName(transprob->fixedvars[v]));
-            if( solval == SCIP_UNKNOWN ) /*lint !e777*/
-               SCIPmessageFPrintInfo(messagehdlr, file, "              unknown");
-            else if( SCIPsetIsInfinity(set, solval) )
-               SCIPmessageFPrintInfo(messagehdlr, file, "            +infinity");
-            else if( SCIPsetIsInfinity(set, -solval) )
-               SCIPmessageFPrintInfo(messagehdlr, file, "            -infinity");
-            else
-               SCIPmessageFPrintInfo(messagehdlr, file, " % 20.15g", solval);
-            SCIPmessageFPrintInfo(messagehdlr, file, " \t(obj:%.15g)\n", SCIPvarGetUnchangedObj(transprob->fixedvars[v]));
+            solPrintVal(set, messagehdlr, file, transprob->fixedvars[v], solval, TRUE);
          }
       }
       for( v = 0; v < transprob->nvars; ++v )
@@ -2401,16 +2402,7 @@ SCIP_RETCODE SCIPsolPrint(
          solval = SCIPsolGetVal(sol, set, stat, transprob->vars[v]);
          if( printzeros || !SCIPsetIsZero(set, solval) )
          {
-            SCIPmessageFPrintInfo(messagehdlr, file, "%-32s", SCIPvarGetName(transprob->vars[v]));
-            if( solval == SCIP_UNKNOWN ) /*lint !e777*/
-               SCIPmessageFPrintInfo(messagehdlr, file, "              unknown");
-            else if( SCIPsetIsInfinity(set, solval) )
-               SCIPmessageFPrintInfo(messagehdlr, file, "            +infinity");
-            else if( SCIPsetIsInfinity(set, -solval) )
-               SCIPmessageFPrintInfo(messagehdlr, file, "            -infinity");
-            else
-               SCIPmessageFPrintInfo(messagehdlr, file, " % 20.15g", solval);
-            SCIPmessageFPrintInfo(messagehdlr, file, " \t(obj:%.15g)\n", SCIPvarGetUnchangedObj(transprob->vars[v]));
+            solPrintVal(set, messagehdlr, file, transprob->vars[v], solval, TRUE);
          }
       }
    }
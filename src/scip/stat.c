@@ -91,8 +91,7 @@ SCIP_RETCODE SCIPstatCreate(
    /* turn statistic timing on or off, depending on the user parameter */
    SCIPstatEnableOrDisableStatClocks(*stat, set->time_statistictiming);
 
-   SCIP_CALL( SCIPhistoryCreate(&(*stat)->glbhistory, blkmem) );
-   SCIP_CALL( SCIPhistoryCreate(&(*stat)->glbhistorycrun, blkmem) );
+   SCIP_CALL( SCIPhistoryCreatePair(&(*stat)->glbhistory, &(*stat)->glbhistorycrun, blkmem) );
    SCIP_CALL( SCIPvisualCreate(&(*stat)->visual, messagehdlr) );
 
    SCIP_CALL( SCIPregressionCreate(&(*stat)->regressioncandsobjval) );
@@ -141,8 +140,7 @@ SCIP_RETCODE SCIPstatFree(
    SCIPclockFree(&(*stat)->strongpropclock);
    SCIPclockFree(&(*stat)->reoptupdatetime);
 
-   SCIPhistoryFree(&(*stat)->glbhistory, blkmem);
-   SCIPhistoryFree(&(*stat)->glbhistorycrun, blkmem);
+   SCIPhistoryFreePair(&(*stat)->glbhistory, &(*stat)->glbhistorycrun, blkmem);
    SCIPvisualFree(&(*stat)->visual);
 
    SCIPregressionFree(&(*stat)->regressioncandsobjval);
@@ -50,6 +50,8 @@ struct SCIP_Messagehdlr
    SCIP_DECL_MESSAGEHDLRFREE((*messagehdlrfree)); /**< destructor of message handler to free message handler data */
    SCIP_MESSAGEHDLRDATA* messagehdlrdata;    /**< message handler data */
    FILE*                 logfile;            /**< log file where to copy messages into */
+   FILE*                 unflushedfile;      /**< file stream that the default message handler does not flush after
+                                              *   each message, or NULL */
    SCIP_Bool             quiet;              /**< should screen messages be suppressed? */
    char*                 warningbuffer;      /**< buffer for constructing complete warning output lines */
    char*                 dialogbuffer;       /**< buffer for constructing complete dialog output lines */
@@ -480,6 +480,9 @@ struct SCIP_Set
    SCIP_Bool             decomp_applybenders;  /**< if a decomposition exists, should Benders' decomposition be applied*/
    int                   decomp_maxgraphedge;  /**< maximum number of edges in block graph computation (-1: no limit, 0: disable block graph computation) */
    SCIP_Bool             decomp_disablemeasures; /**< disable expensive measures */
+   SCIP_Bool             decomp_detect;      /**< should a decomposition be detected automatically if none is given? */
+   int                   decomp_detectmaxblocks; /**< maximum number of blocks of an automatically detected decomposition */
+   SCIP_Real             decomp_detectimbalance; /**< allowed relative deviation of the block sizes from the average in automatic detection */
 
    /* Benders' decomposition settings */
    SCIP_Real             benders_soltol;     /**< the tolerance for checking optimality in Benders' decomposition */
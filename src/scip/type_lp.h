@@ -87,6 +87,9 @@ enum SCIP_LPAlgo
 };
 typedef enum SCIP_LPAlgo SCIP_LPALGO;
 
+/** number of buckets of the signatures used to bound the parallelism of rows, see SCIProwGetParallelismSignature() */
+#define SCIP_PARALLELSIGNATURE_SIZE 64
+
 typedef struct SCIP_ColSolVals SCIP_COLSOLVALS;   /**< collected values of a column which depend on the LP solution */
 typedef struct SCIP_RowSolVals SCIP_ROWSOLVALS;   /**< collected values of a row which depend on the LP solution */
 typedef struct SCIP_LpSolVals SCIP_LPSOLVALS;     /**< collected values of the LP data which depend on the LP solution */
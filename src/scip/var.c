@@ -2059,8 +2059,7 @@ SCIP_RETCODE varCreate(
    stat->nvaridx++;
 
    /* create branching and inference history entries */
-   SCIP_CALL( SCIPhistoryCreate(&(*var)->history, blkmem) );
-   SCIP_CALL( SCIPhistoryCreate(&(*var)->historycrun, blkmem) );
+   SCIP_CALL( SCIPhistoryCreatePair(&(*var)->history, &(*var)->historycrun, blkmem) );
 
    /* the value based history is only created on demand */
    (*var)->valuehistory = NULL;
@@ -2840,8 +2839,7 @@ SCIP_RETCODE varFree(
    BMSfreeBlockMemoryArrayNull(blkmem, &(*var)->ubchginfos, (*var)->ubchginfossize);
 
    /* free branching and inference history entries */
-   SCIPhistoryFree(&(*var)->history, blkmem);
-   SCIPhistoryFree(&(*var)->historycrun, blkmem);
+   SCIPhistoryFreePair(&(*var)->history, &(*var)->historycrun, blkmem);
    SCIPvaluehistoryFree(&(*var)->valuehistory, blkmem);
 
    /* free variable data structure */
@@ -64,7 +64,7 @@
 #define NAME_EXT_SIZE 128
 #define ATTR_EXT_SIZE 4096
 #define DATA_EXT_SIZE 4096
-#define LINE_BUF_SIZE 8192
+#define LINE_BUF_SIZE 65536
 
 #define xmlError(a, b) xmlErrmsg(a, b, FALSE, __FILE__, __LINE__)
 
@@ -1175,13 +1175,17 @@ XML_NODE* SCIPxmlNewNode(
    )
 {
    XML_NODE* n = NULL;
+   size_t namelen;
 
    assert(name != NULL);
 
-   if ( BMSallocMemory(&n) != NULL )
+   /* the name is stored directly behind the node, such that a node needs a single allocation only */
+   namelen = strlen(name) + 1;
+   if ( BMSallocMemorySize(&n, sizeof(*n) + namelen) != NULL )
    {
       BMSclearMemory(n);
-      BMSduplicateMemoryArray(&n->name, name, strlen(name)+1);
+      n->name = (char*) (n + 1);
+      BMScopyMemoryArray(n->name, name, namelen);
       n->lineno = lineno;
    }
    return n;
@@ -1194,15 +1198,22 @@ XML_ATTR* SCIPxmlNewAttr(
    )
 {
    XML_ATTR* a = NULL;
+   size_t namelen;
+   size_t valuelen;
 
    assert(name  != NULL);
    assert(value != NULL);
 
-   if ( BMSallocMemory(&a) != NULL )
+   /* name and value are stored directly behind the attribute, such that an attribute needs a single allocation only */
+   namelen = strlen(name) + 1;
+   valuelen = strlen(value) + 1;
+   if ( BMSallocMemorySize(&a, sizeof(*a) + namelen + valuelen) != NULL )
    {
       BMSclearMemory(a);
-      BMSduplicateMemoryArray(&a->name, name, strlen(name)+1);
-      BMSduplicateMemoryArray(&a->value, value, strlen(value)+1);
+      a->name = (char*) (a + 1);
+      a->value = a->name + namelen;
+      BMScopyMemoryArray(a->name, name, namelen);
+      BMScopyMemoryArray(a->value, value, valuelen);
    }
    return a;
 }
@@ -1260,8 +1271,7 @@ void xmlFreeAttr(
       assert(a->name  != NULL);
       assert(a->value != NULL);
 
-      BMSfreeMemoryArray(&a->name);
-      BMSfreeMemoryArray(&a->value);
+      /* name and value are part of the attribute's memory block */
       BMSfreeMemory(&a);
       a = b;
    }
@@ -1297,7 +1307,7 @@ void SCIPxmlFreeNode(
    }
    assert(node->name != NULL);
 
-   BMSfreeMemoryArray(&node->name);
+   /* the name is part of the node's memory block */
    BMSfreeMemory(&node);
 }
 
@@ -271,3 +271,70 @@ Test(decomptest, test_dec_reader, .description="test decomposition reader")
       printIntArray(strbuf2, labels_vars, NVARS)
       );
 }
+
+Test(decomptest, test_partition, .description="test decomposition computation by hypergraph partitioning")
+{
+   SCIP_DECOMP* partdecomp;
+   SCIP_Bool success;
+   int returnedlabels[NCONSS];
+
+   SCIP_CALL( SCIPcreateDecomp(scip, &partdecomp, nblocks, TRUE, FALSE) );
+
+   SCIP_CALL( SCIPcomputeDecompPartition(scip, partdecomp, nblocks, 0.2, 0, &success) );
+   cr_assert(success);
+
+   /* only the linking constraint connects the two blocks */
+   SCIPdecompGetConsLabels(partdecomp, conss, returnedlabels, NCONSS);
+   cr_assert_eq(returnedlabels[0], SCIP_DECOMP_LINKCONS);
+   cr_assert_neq(returnedlabels[1], SCIP_DECOMP_LINKCONS);
+   cr_assert_neq(returnedlabels[2], SCIP_DECOMP_LINKCONS);
+   cr_assert_neq(returnedlabels[1], returnedlabels[2]);
+
+   SCIPfreeDecomp(scip, &partdecomp);
+}
+
+Test(decomptest, test_detect, .description="test automatic decomposition detection")
+{
+   SCIP_DECOMP** scip_decomps;
+   SCIP_Bool success;
+   int n_decomps;
+
+   SCIP_CALL( SCIPdetectDecomp(scip, TRUE, &success) );
+   cr_assert(success);
+
+   SCIPgetDecomps(scip, &scip_decomps, &n_decomps, TRUE);
+   cr_assert_eq(n_decomps, 1);
+   cr_assert_eq(SCIPdecompGetNBlocks(scip_decomps[0]), 2);
+   cr_assert_eq(SCIPdecompGetNBorderConss(scip_decomps[0]), 1);
+}
+
+Test(decomptest, test_partition_singleton, .description="test that variables of single-variable constraints are assigned to a block")
+{
+   SCIP_DECOMP* partdecomp;
+   SCIP_VAR* singlevar;
+   SCIP_CONS* singlecons;
+   SCIP_Real coef = 1.0;
+   SCIP_Bool success;
+   int varlabel;
+   int conslabel;
+
+   SCIP_CALL( SCIPcreateVarBasic(scip, &singlevar, "w", 0.0, 100.0, 1.0, SCIP_VARTYPE_CONTINUOUS) );
+   SCIP_CALL( SCIPaddVar(scip, singlevar) );
+   SCIP_CALL( SCIPcreateConsBasicLinear(scip, &singlecons, "singlecons", 1, &singlevar, &coef, 1.0, SCIPinfinity(scip)) );
+   SCIP_CALL( SCIPaddCons(scip, singlecons) );
+
+   SCIP_CALL( SCIPcreateDecomp(scip, &partdecomp, nblocks, TRUE, FALSE) );
+
+   SCIP_CALL( SCIPcomputeDecompPartition(scip, partdecomp, nblocks, 0.2, 0, &success) );
+   cr_assert(success);
+
+   /* the variable and its constraint belong to a block and do not link the blocks */
+   SCIPdecompGetVarsLabels(partdecomp, &singlevar, &varlabel, 1);
+   SCIPdecompGetConsLabels(partdecomp, &singlecons, &conslabel, 1);
+   cr_assert_neq(varlabel, SCIP_DECOMP_LINKVAR);
+   cr_assert_eq(conslabel, varlabel);
+
+   SCIPfreeDecomp(scip, &partdecomp);
+   SCIP_CALL( SCIPreleaseCons(scip, &singlecons) );
+   SCIP_CALL( SCIPreleaseVar(scip, &singlevar) );
+}
@@ -0,0 +1,129 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   adaptivediving.c
+ * @brief  unit test for diving with several divesets in parallel in heur_adaptivediving
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/scip.h"
+#include "scip/scipdefplugins.h"
+/* we include the source file here to check in the heuristic data whether the dives ran in parallel */
+#include "scip/heur_adaptivediving.c"
+
+#include "include/scip_test.h"
+
+#define NVARS 20
+
+/** solves the problem
+ *
+ *  max sum_i p_i x_i
+ *  s.t. sum_i w_i x_i <= 50, sum_i v_i x_i <= 45, x binary
+ *
+ *  with adaptive diving as the only primal heuristic, which is called at every node, and without presolving and
+ *  separation, such that the root LP is fractional and the dives start from it
+ *
+ *  returns the number of calls of adaptive diving that dived in parallel
+ */
+static
+int solveProb(
+   int                   nthreads,           /**< number of threads to dive with */
+   SCIP_Real*            objval              /**< pointer to store the optimal objective value */
+   )
+{
+   SCIP* scip;
+   SCIP_VAR* vars[NVARS];
+   SCIP_CONS* cons;
+   SCIP_HEUR* heur;
+   SCIP_Real profits[NVARS] = { 12, 7, 11, 8, 9, 14, 6, 10, 13, 5, 9, 12, 8, 7, 11, 6, 10, 13, 9, 8 };
+   SCIP_Real weights[NVARS] = { 7, 4, 6, 5, 5, 9, 3, 6, 8, 3, 6, 7, 5, 4, 7, 4, 6, 8, 5, 5 };
+   SCIP_Real volumes[NVARS] = { 5, 6, 7, 3, 6, 7, 4, 5, 6, 4, 5, 8, 4, 6, 5, 3, 7, 6, 6, 4 };
+   char name[SCIP_MAXSTRLEN];
+   int nparallelcalls;
+   int i;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+   SCIP_CALL( SCIPsetIntParam(scip, "display/verblevel", 0) );
+
+   SCIP_CALL( SCIPsetPresolving(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetSeparating(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetHeuristics(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetIntParam(scip, "heuristics/" HEUR_NAME "/freq", 1) );
+   SCIP_CALL( SCIPsetIntParam(scip, "heuristics/" HEUR_NAME "/freqofs", 0) );
+   SCIP_CALL( SCIPsetIntParam(scip, "heuristics/" HEUR_NAME "/nthreads", nthreads) );
+
+   SCIP_CALL( SCIPcreateProbBasic(scip, "adaptivediving") );
+   SCIP_CALL( SCIPsetObjsense(scip, SCIP_OBJSENSE_MAXIMIZE) );
+
+   for( i = 0; i < NVARS; ++i )
+   {
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "x%d", i);
+      SCIP_CALL( SCIPcreateVarBasic(scip, &vars[i], name, 0.0, 1.0, profits[i], SCIP_VARTYPE_BINARY) );
+      SCIP_CALL( SCIPaddVar(scip, vars[i]) );
+   }
+
+   SCIP_CALL( SCIPcreateConsBasicLinear(scip, &cons, "weight", NVARS, vars, weights, -SCIPinfinity(scip), 50.0) );
+   SCIP_CALL( SCIPaddCons(scip, cons) );
+   SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+
+   SCIP_CALL( SCIPcreateConsBasicLinear(scip, &cons, "volume", NVARS, vars, volumes, -SCIPinfinity(scip), 45.0) );
+   SCIP_CALL( SCIPaddCons(scip, cons) );
+   SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+
+   SCIP_CALL( SCIPsolve(scip) );
+
+   cr_assert_eq(SCIPgetStatus(scip), SCIP_STATUS_OPTIMAL);
+   *objval = SCIPgetPrimalbound(scip);
+
+   heur = SCIPfindHeur(scip, HEUR_NAME);
+   cr_assert_not_null(heur);
+   nparallelcalls = SCIPheurGetData(heur)->nparallelcalls;
+
+   for( i = 0; i < NVARS; ++i )
+   {
+      SCIP_CALL( SCIPreleaseVar(scip, &vars[i]) );
+   }
+
+   SCIP_CALL( SCIPfree(&scip) );
+
+   return nparallelcalls;
+}
+
+/* TESTS */
+Test(adaptivediving, parallel, .description = "check that diving in parallel runs and the problem is solved correctly")
+{
+   SCIP_Real seqobjval;
+   SCIP_Real parobjval;
+
+   cr_assert_eq(solveProb(1, &seqobjval), 0);
+
+   /* the parallel path must have been taken, otherwise the comparison below would be trivial */
+   cr_assert_gt(solveProb(4, &parobjval), 0, "adaptive diving did not dive in parallel");
+
+   cr_assert_eq(parobjval, seqobjval, "optimal value %g in parallel, %g sequentially", parobjval, seqobjval);
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
@@ -571,3 +571,117 @@ Test(more_vars, test1)
    cr_expect_float_eq(binvarow[2], 0.0, EPS, "BInvARow[%d] = %g != %g\n", 2, binvarow[2], 0.0);
    cr_expect_float_eq(binvarow[3], -6.0, EPS, "BInvARow[%d] = %g != %g\n", 3, binvarow[3], -6.0);
 }
+
+
+/*** TEST SUITE SPARSE ***/
+#define NBLOCKS 5
+
+static
+void setup_sparse(void)
+{
+   SCIP_Real obj[2 * NBLOCKS];
+   SCIP_Real lb[2 * NBLOCKS];
+   SCIP_Real ub[2 * NBLOCKS];
+   SCIP_Real lhs[2 * NBLOCKS];
+   SCIP_Real rhs[2 * NBLOCKS];
+   SCIP_Real val[4 * NBLOCKS];
+   int beg[2 * NBLOCKS];
+   int ind[4 * NBLOCKS];
+   int k;
+
+   lpi = NULL;
+
+   /* create LPI */
+   SCIP_CALL( SCIPlpiCreate(&lpi, NULL, "prob", SCIP_OBJSEN_MAXIMIZE) );
+
+   /* use the following LP with NBLOCKS independent blocks k = 0, ..., NBLOCKS - 1 as base:
+    *   max 2 x_2k + x_2k+1
+    *            x_2k + x_2k+1 <= 2
+    *            x_2k - x_2k+1 <= 1
+    *       0 <= x_2k, x_2k+1 <= 10
+    *
+    * the optimal basis of each block consists of its two columns, so the rows of B^-1 have 2 of 2 * NBLOCKS nonzeros
+    */
+   for( k = 0; k < 2 * NBLOCKS; ++k )
+   {
+      obj[k] = (k % 2 == 0) ? 2.0 : 1.0;
+      lb[k] = 0.0;
+      ub[k] = 10.0;
+      lhs[k] = -SCIPlpiInfinity(lpi);
+      rhs[k] = (k % 2 == 0) ? 2.0 : 1.0;
+      beg[k] = 2 * k;
+      ind[2 * k] = k - k % 2;
+      ind[2 * k + 1] = k - k % 2 + 1;
+      val[2 * k] = 1.0;
+      val[2 * k + 1] = (k % 2 == 0) ? 1.0 : -1.0;
+   }
+
+   SCIP_CALL( SCIPlpiAddCols(lpi, 2 * NBLOCKS, obj, lb, ub, NULL, 0, NULL, NULL, NULL) );
+   SCIP_CALL( SCIPlpiAddRows(lpi, 2 * NBLOCKS, lhs, rhs, NULL, 4 * NBLOCKS, beg, ind, val) );
+
+#ifdef SCIP_DEBUG
+   /* turn on output */
+   SCIP_CALL( SCIPlpiSetIntpar(lpi, SCIP_LPPAR_LPINFO, 1) );
+#endif
+}
+
+TestSuite(sparse, .init = setup_sparse, .fini = teardown);
+
+/*** TESTS ***/
+Test(sparse, binvarow, .description = "check that the rows of B^-1 A equal the rows of B^-1 times A for sparse rows of B^-1")
+{
+   SCIP_Real binvrow[2 * NBLOCKS];
+   SCIP_Real binvarow[2 * NBLOCKS];
+   SCIP_Real product[2 * NBLOCKS];
+   SCIP_Real val[4 * NBLOCKS];
+   SCIP_Real objval;
+   int beg[2 * NBLOCKS];
+   int ind[4 * NBLOCKS];
+   int nnonz;
+   int r;
+
+   SCIP_CALL( SCIPlpiSolvePrimal(lpi) );
+
+   SCIP_CALL( SCIPlpiGetObjval(lpi, &objval) );
+   cr_assert_float_eq(objval, 3.5 * NBLOCKS, EPS);
+
+   /* get the constraint matrix row by row */
+   SCIP_CALL( SCIPlpiGetRows(lpi, 0, 2 * NBLOCKS - 1, NULL, NULL, &nnonz, beg, ind, val) );
+   cr_assert_eq(nnonz, 4 * NBLOCKS);
+
+   for( r = 0; r < 2 * NBLOCKS; ++r )
+   {
+      int i;
+      int c;
+
+      SCIP_CALL( SCIPlpiGetBInvRow(lpi, r, binvrow, NULL, NULL) );
+      SCIP_CALL( SCIPlpiGetBInvARow(lpi, r, NULL, binvarow, NULL, NULL) );
+
+      /* compute the product of the row of B^-1 and A */
+      for( c = 0; c < 2 * NBLOCKS; ++c )
+         product[c] = 0.0;
+
+      for( i = 0; i < 2 * NBLOCKS; ++i )
+      {
+         int end = (i < 2 * NBLOCKS - 1) ? beg[i + 1] : nnonz;
+         int j;
+
+         for( j = beg[i]; j < end; ++j )
+            product[ind[j]] += binvrow[i] * val[j];
+      }
+
+      for( c = 0; c < 2 * NBLOCKS; ++c )
+      {
+         cr_expect_float_eq(binvarow[c], product[c], EPS, "BInvARow[%d][%d] = %g != %g\n", r, c, binvarow[c],
+            product[c]);
+      }
+
+      /* the row of B^-1 A is also computed correctly from a given row of B^-1 */
+      SCIP_CALL( SCIPlpiGetBInvARow(lpi, r, binvrow, binvarow, NULL, NULL) );
+      for( c = 0; c < 2 * NBLOCKS; ++c )
+      {
+         cr_expect_float_eq(binvarow[c], product[c], EPS, "BInvARow[%d][%d] = %g != %g\n", r, c, binvarow[c],
+            product[c]);
+      }
+   }
+}
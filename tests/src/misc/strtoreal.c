@@ -0,0 +1,100 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   strtoreal.c
+ * @brief  unit tests for parsing real values from strings
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "scip/pub_misc.h"
+
+#include "include/scip_test.h"
+
+/** checks that SCIPstrToRealValue() parses the same value and the same prefix as strtod() */
+static
+void checkStrtod(
+   const char*           str                 /**< string to parse */
+   )
+{
+   SCIP_Real value;
+   double expected;
+   char* endptr;
+   char* expectedendptr;
+   SCIP_Bool success;
+
+   success = SCIPstrToRealValue(str, &value, &endptr);
+   expected = strtod(str, &expectedendptr);
+
+   if( expectedendptr == str )
+   {
+      cr_expect(!success, "parsing <%s> should fail", str);
+      cr_expect_eq(endptr, str);
+      return;
+   }
+
+   cr_expect(success, "parsing <%s> should succeed", str);
+   cr_expect_eq(endptr, expectedendptr, "parsed prefix of <%s> differs from strtod()", str);
+   cr_expect(memcmp(&value, &expected, sizeof(double)) == 0, "parsed value of <%s> is %.17g instead of %.17g", str,
+      value, expected);
+}
+
+/* TEST SUITE */
+TestSuite(strtoreal);
+
+Test(strtoreal, decimals, .description = "tests short decimal numbers that are parsed without strtod()")
+{
+   checkStrtod("0");
+   checkStrtod("-0");
+   checkStrtod("17");
+   checkStrtod("+17");
+   checkStrtod("-2.5");
+   checkStrtod("0.1");
+   checkStrtod(".5");
+   checkStrtod("24311.");
+   checkStrtod("3.14159265358979");
+   checkStrtod("1e22");
+   checkStrtod("2.5E-10");
+   checkStrtod("123456789012345");
+   checkStrtod("0000000000000000001.5");
+}
+
+Test(strtoreal, fallback, .description = "tests numbers and prefixes that need strtod()")
+{
+   checkStrtod("1234567890123456789");
+   checkStrtod("1.0000000000000000001");
+   checkStrtod("1e23");
+   checkStrtod("7.038531e-26");
+   checkStrtod("0e999999");
+   checkStrtod("1e");
+   checkStrtod("1e+x");
+   checkStrtod("12abc");
+   checkStrtod("0x1A");
+   checkStrtod("inf");
+   checkStrtod("  5");
+   checkStrtod("x1");
+   checkStrtod("-");
+   checkStrtod(".");
+}
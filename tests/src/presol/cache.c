@@ -0,0 +1,223 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   cache.c
+ * @brief  unit test for the presolving cache
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "scip/scip.h"
+#include "scip/scipdefplugins.h"
+
+#include "include/scip_test.h"
+
+/* GLOBAL VARIABLES */
+static SCIP* scip;
+static SCIP_CONS* knapcons;
+static char cachedir[] = "presolcacheXXXXXX";
+
+/** creates the problem
+ *
+ *  max/min 3 x0 + 2 x1 + 4 x2 + 5 x3 + x4 - 2 x5
+ *     s.t.   2 x0 + 2 x1                         <=  1
+ *                   3 x2 + coef x3 + 4 x4 + 7 x5 <= 23
+ *                   2 x2 +    3 x3 - 5 x4 + 4 x5 >=  6
+ *            x0, x1 binary, x2, ..., x5 integer in [0,10]
+ */
+static
+void createProb(
+   const char*           name,               /**< name of the problem */
+   SCIP_OBJSENSE         objsense,           /**< objective sense */
+   SCIP_Real             coef                /**< coefficient of x3 in the second constraint */
+   )
+{
+   SCIP_VAR* vars[6];
+   SCIP_CONS* cons;
+   SCIP_Real objs[6] = { 3.0, 2.0, 4.0, 5.0, 1.0, -2.0 };
+   SCIP_Real vals[4];
+   char varname[SCIP_MAXSTRLEN];
+   int i;
+
+   SCIP_CALL( SCIPcreateProbBasic(scip, name) );
+   SCIP_CALL( SCIPsetObjsense(scip, objsense) );
+
+   for( i = 0; i < 6; ++i )
+   {
+      (void) SCIPsnprintf(varname, SCIP_MAXSTRLEN, "x%d", i);
+      SCIP_CALL( SCIPcreateVarBasic(scip, &vars[i], varname, 0.0, i < 2 ? 1.0 : 10.0, objs[i],
+            i < 2 ? SCIP_VARTYPE_BINARY : SCIP_VARTYPE_INTEGER) );
+      SCIP_CALL( SCIPaddVar(scip, vars[i]) );
+   }
+
+   vals[0] = 2.0;
+   vals[1] = 2.0;
+   SCIP_CALL( SCIPcreateConsBasicLinear(scip, &cons, "fixing", 2, vars, vals, -SCIPinfinity(scip), 1.0) );
+   SCIP_CALL( SCIPaddCons(scip, cons) );
+   SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+
+   vals[0] = 3.0;
+   vals[1] = coef;
+   vals[2] = 4.0;
+   vals[3] = 7.0;
+   SCIP_CALL( SCIPcreateConsBasicLinear(scip, &knapcons, "knapsack", 4, &vars[2], vals, -SCIPinfinity(scip), 23.0) );
+   SCIP_CALL( SCIPaddCons(scip, knapcons) );
+
+   vals[0] = 2.0;
+   vals[1] = 3.0;
+   vals[2] = -5.0;
+   vals[3] = 4.0;
+   SCIP_CALL( SCIPcreateConsBasicLinear(scip, &cons, "cover", 4, &vars[2], vals, 6.0, SCIPinfinity(scip)) );
+   SCIP_CALL( SCIPaddCons(scip, cons) );
+   SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+
+   for( i = 0; i < 6; ++i )
+   {
+      SCIP_CALL( SCIPreleaseVar(scip, &vars[i]) );
+   }
+}
+
+/** presolves the problem and returns the number of variables fixed by the cache presolver */
+static
+int presolve(void)
+{
+   SCIP_CALL( SCIPfreeTransform(scip) );
+   SCIP_CALL( SCIPpresolve(scip) );
+   cr_assert_eq(SCIPgetStage(scip), SCIP_STAGE_PRESOLVED);
+
+   return SCIPpresolGetNFixedVars(SCIPfindPresol(scip, "cache"));
+}
+
+/** returns the number of files in the cache directory */
+static
+int countCacheFiles(void)
+{
+   struct dirent* entry;
+   DIR* dir;
+   int nfiles;
+
+   dir = opendir(cachedir);
+   cr_assert_not_null(dir);
+
+   nfiles = 0;
+   while( (entry = readdir(dir)) != NULL )
+   {
+      if( entry->d_name[0] != '.' )
+         ++nfiles;
+   }
+   (void) closedir(dir);
+
+   return nfiles;
+}
+
+/* TEST SUITE */
+static
+void setup(void)
+{
+   cr_assert_not_null(mkdtemp(cachedir));
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+   SCIP_CALL( SCIPsetIntParam(scip, "display/verblevel", 0) );
+   SCIP_CALL( SCIPsetStringParam(scip, "presolving/cache/dir", cachedir) );
+
+   createProb("cachetest", SCIP_OBJSENSE_MAXIMIZE, 5.0);
+}
+
+static
+void teardown(void)
+{
+   struct dirent* entry;
+   DIR* dir;
+
+   SCIP_CALL( SCIPreleaseCons(scip, &knapcons) );
+   SCIP_CALL( SCIPfree(&scip) );
+
+   /* remove the cache files and the cache directory */
+   dir = opendir(cachedir);
+   if( dir != NULL )
+   {
+      while( (entry = readdir(dir)) != NULL )
+      {
+         char filename[SCIP_MAXSTRLEN];
+
+         if( entry->d_name[0] == '.' )
+            continue;
+
+         (void) SCIPsnprintf(filename, SCIP_MAXSTRLEN, "%s/%s", cachedir, entry->d_name);
+         (void) remove(filename);
+      }
+      (void) closedir(dir);
+   }
+   (void) rmdir(cachedir);
+
+   BMScheckEmptyMemory();
+}
+
+TestSuite(presolcache, .init = setup, .fini = teardown);
+
+/* TESTS */
+Test(presolcache, hit, .description = "check that the reductions of an identical problem are taken from the cache")
+{
+   cr_assert_eq(presolve(), 0);
+   cr_assert_eq(countCacheFiles(), 1);
+
+   cr_assert_gt(presolve(), 0);
+   cr_assert_eq(countCacheFiles(), 1);
+}
+
+Test(presolcache, changedcoef, .description = "check that a changed coefficient misses the cache")
+{
+   SCIP_VAR* var;
+
+   cr_assert_eq(presolve(), 0);
+   cr_assert_eq(countCacheFiles(), 1);
+
+   SCIP_CALL( SCIPfreeTransform(scip) );
+   var = SCIPfindVar(scip, "x3");
+   cr_assert_not_null(var);
+   SCIP_CALL( SCIPchgCoefLinear(scip, knapcons, var, 6.0) );
+
+   cr_assert_eq(presolve(), 0);
+   cr_assert_eq(countCacheFiles(), 2);
+}
+
+Test(presolcache, otherproblem, .description = "check that a different problem misses the cache")
+{
+   cr_assert_eq(presolve(), 0);
+   cr_assert_eq(countCacheFiles(), 1);
+
+   /* the same constraints with the opposite objective sense */
+   SCIP_CALL( SCIPreleaseCons(scip, &knapcons) );
+   SCIP_CALL( SCIPfreeProb(scip) );
+   createProb("othertest", SCIP_OBJSENSE_MINIMIZE, 5.0);
+
+   cr_assert_eq(presolve(), 0);
+   cr_assert_eq(countCacheFiles(), 2);
+}
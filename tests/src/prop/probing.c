@@ -0,0 +1,175 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   probing.c
+ * @brief  unit test for probing in parallel during presolving in prop_probing
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/scip.h"
+#include "scip/scipdefplugins.h"
+/* we include the source file here to check in the propagator data whether probing ran in parallel */
+#include "scip/prop_probing.c"
+
+#include "include/scip_test.h"
+
+#define NVARS 8
+
+/** adds the linear constraint lhs <= vals[0] vars[idxs[0]] + vals[1] vars[idxs[1]] + ... <= rhs */
+static
+void addLinearCons(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_VAR**            vars,               /**< variables of the problem */
+   int                   nconsvars,          /**< number of variables in the constraint */
+   int*                  idxs,               /**< indices of the variables in the constraint */
+   SCIP_Real*            vals,               /**< coefficients of the variables */
+   SCIP_Real             lhs,                /**< left-hand side */
+   SCIP_Real             rhs                 /**< right-hand side */
+   )
+{
+   SCIP_VAR* consvars[NVARS];
+   SCIP_CONS* cons;
+   int i;
+
+   for( i = 0; i < nconsvars; ++i )
+      consvars[i] = vars[idxs[i]];
+
+   SCIP_CALL( SCIPcreateConsBasicLinear(scip, &cons, "cons", nconsvars, consvars, vals, lhs, rhs) );
+   SCIP_CALL( SCIPaddCons(scip, cons) );
+   SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+}
+
+/** presolves the problem
+ *
+ *  min x0 + x1 + x2 + x3 - 3 x4 - 4 x5 - 5 x6 + x7
+ *  s.t. x0 - x1 <= 0, x0 + x1 <= 1, x2 + x3 >= 1, x3 - x2 >= 0, 3 x4 + 4 x5 + 5 x6 <= 8 + 2 x7
+ *       x0, ..., x6 binary, x7 in [0,4]
+ *
+ *  with probing as the only presolving method, and stores the global bounds of the variables afterwards; probing
+ *  on x0 fixes it to 0, and probing on x2 fixes x3 to 1
+ *
+ *  returns the number of presolving calls in which probing ran in parallel
+ */
+static
+int presolveProb(
+   int                   nthreads,           /**< number of threads to probe with */
+   SCIP_Real*            lbs,                /**< array to store the global lower bounds */
+   SCIP_Real*            ubs                 /**< array to store the global upper bounds */
+   )
+{
+   SCIP* scip;
+   SCIP_PROP* prop;
+   int nparallelcalls;
+   SCIP_VAR* vars[NVARS];
+   SCIP_Real objs[NVARS] = { 1.0, 1.0, 1.0, 1.0, -3.0, -4.0, -5.0, 1.0 };
+   int idxs[4];
+   SCIP_Real vals[4];
+   char name[SCIP_MAXSTRLEN];
+   int i;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+   SCIP_CALL( SCIPsetIntParam(scip, "display/verblevel", 0) );
+
+   /* probe on all binary variables, but do not presolve otherwise */
+   SCIP_CALL( SCIPsetPresolving(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetIntParam(scip, "presolving/maxrounds", -1) );
+   SCIP_CALL( SCIPsetIntParam(scip, "propagating/probing/maxprerounds", -1) );
+   SCIP_CALL( SCIPsetIntParam(scip, "propagating/probing/nthreads", nthreads) );
+
+   SCIP_CALL( SCIPcreateProbBasic(scip, "probing") );
+
+   for( i = 0; i < NVARS; ++i )
+   {
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "x%d", i);
+      SCIP_CALL( SCIPcreateVarBasic(scip, &vars[i], name, 0.0, i < NVARS - 1 ? 1.0 : 4.0, objs[i],
+            i < NVARS - 1 ? SCIP_VARTYPE_BINARY : SCIP_VARTYPE_INTEGER) );
+      SCIP_CALL( SCIPaddVar(scip, vars[i]) );
+   }
+
+   idxs[0] = 0; idxs[1] = 1;
+   vals[0] = 1.0; vals[1] = -1.0;
+   addLinearCons(scip, vars, 2, idxs, vals, -SCIPinfinity(scip), 0.0);
+   vals[1] = 1.0;
+   addLinearCons(scip, vars, 2, idxs, vals, -SCIPinfinity(scip), 1.0);
+
+   idxs[0] = 2; idxs[1] = 3;
+   vals[0] = 1.0; vals[1] = 1.0;
+   addLinearCons(scip, vars, 2, idxs, vals, 1.0, SCIPinfinity(scip));
+   vals[0] = -1.0;
+   addLinearCons(scip, vars, 2, idxs, vals, 0.0, SCIPinfinity(scip));
+
+   idxs[0] = 4; idxs[1] = 5; idxs[2] = 6; idxs[3] = 7;
+   vals[0] = 3.0; vals[1] = 4.0; vals[2] = 5.0; vals[3] = -2.0;
+   addLinearCons(scip, vars, 4, idxs, vals, -SCIPinfinity(scip), 8.0);
+
+   SCIP_CALL( SCIPpresolve(scip) );
+
+   prop = SCIPfindProp(scip, PROP_NAME);
+   cr_assert_not_null(prop);
+   nparallelcalls = SCIPpropGetData(prop)->nparallelcalls;
+
+   for( i = 0; i < NVARS; ++i )
+   {
+      SCIP_VAR* transvar = SCIPvarGetTransVar(vars[i]);
+
+      cr_assert_not_null(transvar);
+      lbs[i] = SCIPvarGetLbGlobal(transvar);
+      ubs[i] = SCIPvarGetUbGlobal(transvar);
+
+      SCIP_CALL( SCIPreleaseVar(scip, &vars[i]) );
+   }
+
+   SCIP_CALL( SCIPfree(&scip) );
+
+   return nparallelcalls;
+}
+
+/* TESTS */
+Test(probing, parallel, .description = "check that probing in parallel finds the same fixings as sequential probing")
+{
+   SCIP_Real seqlbs[NVARS];
+   SCIP_Real sequbs[NVARS];
+   SCIP_Real parlbs[NVARS];
+   SCIP_Real parubs[NVARS];
+   int i;
+
+   cr_assert_eq(presolveProb(1, seqlbs, sequbs), 0);
+
+   /* the parallel path must have been taken, otherwise the comparison below would be trivial */
+   cr_assert_gt(presolveProb(4, parlbs, parubs), 0, "probing did not run in parallel");
+
+   /* the deductions of the rows are found in both modes */
+   cr_assert_eq(sequbs[0], 0.0);
+   cr_assert_eq(seqlbs[3], 1.0);
+
+   for( i = 0; i < NVARS; ++i )
+   {
+      cr_assert_eq(parlbs[i], seqlbs[i], "lower bound of x%d: %g in parallel, %g sequentially", i, parlbs[i], seqlbs[i]);
+      cr_assert_eq(parubs[i], sequbs[i], "upper bound of x%d: %g in parallel, %g sequentially", i, parubs[i], sequbs[i]);
+   }
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
@@ -0,0 +1,122 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   solbinary.c
+ * @brief  unit tests for writing and reading binary solution files
+ */
+
+/*--+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/scip.h"
+
+#include "include/scip_test.h"
+
+#define NVARS 5
+
+static SCIP* scip;
+static SCIP_VAR* vars[NVARS];
+static const char* filename = "solbinary.solb";
+
+static
+void setup(void)
+{
+   char name[SCIP_MAXSTRLEN];
+   int i;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPcreateProbBasic(scip, "problem") );
+
+   for( i = 0; i < NVARS; ++i )
+   {
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "x%d", i);
+      SCIP_CALL( SCIPcreateVarBasic(scip, &vars[i], name, -10.0, 10.0, 1.0,
+            i % 2 == 0 ? SCIP_VARTYPE_INTEGER : SCIP_VARTYPE_CONTINUOUS) );
+      SCIP_CALL( SCIPaddVar(scip, vars[i]) );
+   }
+}
+
+static
+void teardown(void)
+{
+   int i;
+
+   for( i = 0; i < NVARS; ++i )
+   {
+      SCIP_CALL( SCIPreleaseVar(scip, &vars[i]) );
+   }
+   SCIP_CALL( SCIPfree(&scip) );
+
+   (void) remove(filename);
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+TestSuite(solbinary, .init = setup, .fini = teardown);
+
+Test(solbinary, roundtrip, .description = "check that a solution is read back as written")
+{
+   SCIP_Real vals[NVARS] = { 1.0, -2.5, 0.0, 1e-7, 3.0 };
+   SCIP_SOL* sol;
+   SCIP_Bool partial;
+   SCIP_Bool error;
+   int i;
+
+   SCIP_CALL( SCIPcreateOrigSol(scip, &sol, NULL) );
+   SCIP_CALL( SCIPsetSolVals(scip, sol, NVARS, vars, vals) );
+   SCIP_CALL( SCIPwriteSolBinary(scip, sol, filename) );
+   SCIP_CALL( SCIPfreeSol(scip, &sol) );
+
+   SCIP_CALL( SCIPcreateOrigSol(scip, &sol, NULL) );
+   SCIP_CALL( SCIPreadSolBinary(scip, filename, sol, &partial, &error) );
+
+   cr_assert(!error);
+   cr_assert(!partial);
+   for( i = 0; i < NVARS; ++i )
+      cr_expect_eq(SCIPgetSolVal(scip, sol, vars[i]), vals[i], "value of x%d differs", i);
+   cr_expect(SCIPisEQ(scip, SCIPgetSolOrigObj(scip, sol), 1.0 - 2.5 + 1e-7 + 3.0));
+
+   SCIP_CALL( SCIPfreeSol(scip, &sol) );
+}
+
+Test(solbinary, otherproblem, .description = "check that a solution file of a different problem is rejected")
+{
+   SCIP_VAR* y;
+   SCIP_SOL* sol;
+   SCIP_Bool error;
+
+   SCIP_CALL( SCIPcreateOrigSol(scip, &sol, NULL) );
+   SCIP_CALL( SCIPwriteSolBinary(scip, sol, filename) );
+   SCIP_CALL( SCIPfreeSol(scip, &sol) );
+
+   /* adding a variable changes the fingerprint of the problem */
+   SCIP_CALL( SCIPcreateVarBasic(scip, &y, "y", 0.0, 1.0, 0.0, SCIP_VARTYPE_BINARY) );
+   SCIP_CALL( SCIPaddVar(scip, y) );
+
+   SCIP_CALL( SCIPcreateOrigSol(scip, &sol, NULL) );
+   SCIP_CALL( SCIPreadSolBinary(scip, filename, sol, NULL, &error) );
+   cr_expect(error);
+
+   SCIP_CALL( SCIPfreeSol(scip, &sol) );
+   SCIP_CALL( SCIPreleaseVar(scip, &y) );
+}